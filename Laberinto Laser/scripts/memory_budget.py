@@ -0,0 +1,63 @@
+# PlatformIO post-build script: prints the memory budget of the firmware.
+#
+# - DRAM/IRAM/flash use per section group, against the ESP32 limits
+# - the largest statically allocated objects (task stacks, queue storage)
+#
+# Everything the firmware needs at runtime is allocated statically (see
+# src/taskmem.cpp), so this report is the memory budget. The runtime
+# "Heap (...)" log lines should stay flat from boot to session end.
+Import("env")
+
+import subprocess
+
+DRAM_LIMIT = 180 * 1024   # usable static DRAM on ESP32 with the Arduino core
+IRAM_LIMIT = 128 * 1024
+FLASH_LIMIT = 1280 * 1024  # default app partition
+TOP_SYMBOLS = 12
+
+DRAM_SECTIONS = (".dram0.data", ".dram0.bss", ".noinit")
+IRAM_SECTIONS = (".iram0.text", ".iram0.vectors")
+FLASH_SECTIONS = (".flash.text", ".flash.rodata", ".flash.appdesc")
+
+
+def tool(name):
+    return env.subst("$CC").replace("-gcc", "-" + name)
+
+
+def section_sizes(elf):
+    out = subprocess.check_output([tool("size"), "-A", elf], text=True)
+    sizes = {}
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 2 and parts[0].startswith(".") and parts[1].isdigit():
+            sizes[parts[0]] = int(parts[1])
+    return sizes
+
+
+def largest_symbols(elf):
+    out = subprocess.check_output([tool("nm"), "-S", "--size-sort", "-C", elf], text=True)
+    symbols = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "bBdD":
+            symbols.append((int(parts[1], 16), parts[3]))
+    return symbols[-TOP_SYMBOLS:][::-1]
+
+
+def row(name, used, limit):
+    print("  %-6s %8d / %8d bytes  (%5.1f%%)" % (name, used, limit, 100.0 * used / limit))
+
+
+def memory_budget(source, target, env):
+    elf = str(target[0])
+    sizes = section_sizes(elf)
+    print("Memory budget:")
+    row("DRAM", sum(sizes.get(s, 0) for s in DRAM_SECTIONS), DRAM_LIMIT)
+    row("IRAM", sum(sizes.get(s, 0) for s in IRAM_SECTIONS), IRAM_LIMIT)
+    row("Flash", sum(sizes.get(s, 0) for s in FLASH_SECTIONS), FLASH_LIMIT)
+    print("Largest static objects:")
+    for size, name in largest_symbols(elf):
+        print("  %8d  %s" % (size, name))
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", memory_budget)
@@ -0,0 +1,190 @@
+#include "globals.h"
+#include "functions.h"
+#include "beams.h"
+#include "supervisor.h"
+#include "align.h"
+
+// Fitted status LEDs, one beam each. Beams 7-8 are on the second page.
+static const uint8_t alignLeds[] = {LED_I2C, LED_DFPLAYER, LED_WIFI, LED_PREPARATION_READY,
+                                    LED_QUEST_0, LED_CONSEQUENCE_0};
+#define ALIGN_LED_COUNT (sizeof(alignLeds) / sizeof(alignLeds[0]))
+#define ALIGN_PAGES ((NUM_LASERS + ALIGN_LED_COUNT - 1) / ALIGN_LED_COUNT)
+
+static const char qualityCode[] = {'.', 'f', 'm', '#'};
+static const char *const qualityName[] = {"dark", "flickering", "marginal", "OK"};
+
+// The status LEDs are shared by both lanes; one lane shows its beams at a time.
+static GameLane *ledOwner = NULL;
+static uint8_t savedLeds[ALIGN_LED_COUNT];  // states before the owner took them
+
+// Sliding window of raw samples (bit set: beam broken) with running counts.
+struct AlignWindow {
+    uint8_t samples[ALIGN_WINDOW];
+    uint16_t head;
+    uint16_t filled;
+    uint16_t intact[NUM_LASERS];
+};
+
+static void windowPush(AlignWindow *w, uint8_t broken) {
+    if (w->filled == ALIGN_WINDOW) {
+        uint8_t oldest = w->samples[w->head];
+        for (uint8_t i = 0; i < NUM_LASERS; i++) {
+            if (!(oldest & (1 << i))) w->intact[i]--;
+        }
+    } else {
+        w->filled++;
+    }
+    w->samples[w->head] = broken;
+    for (uint8_t i = 0; i < NUM_LASERS; i++) {
+        if (!(broken & (1 << i))) w->intact[i]++;
+    }
+    w->head = (w->head + 1) % ALIGN_WINDOW;
+}
+
+static uint8_t intactPct(const AlignWindow *w, uint8_t beam) {
+    return w->filled ? w->intact[beam] * 100 / w->filled : 0;
+}
+
+static BeamQuality classify(uint8_t pct) {
+    if (pct >= ALIGN_OK_PCT) return BEAM_OK;
+    if (pct >= ALIGN_MARGINAL_PCT) return BEAM_MARGINAL;
+    if (pct > ALIGN_DARK_PCT) return BEAM_FLICKERING;
+    return BEAM_DARK;
+}
+
+// On: aligned. Slow blink: marginal. Fast blink: flickering. Off: dark.
+static void showLeds(const BeamQuality *quality, uint8_t page, bool *ledState) {
+    TickType_t now = xTaskGetTickCount();
+    bool slow = (now / pdMS_TO_TICKS(250)) & 1;
+    bool fast = (now / pdMS_TO_TICKS(62)) & 1;
+    for (uint8_t l = 0; l < ALIGN_LED_COUNT; l++) {
+        uint8_t beam = page * ALIGN_LED_COUNT + l;
+        bool on = false;
+        if (beam < NUM_LASERS) {
+            switch (quality[beam]) {
+                case BEAM_OK:         on = true; break;
+                case BEAM_MARGINAL:   on = slow; break;
+                case BEAM_FLICKERING: on = fast; break;
+                case BEAM_DARK:       on = false; break;
+            }
+        }
+        if (on != ledState[l]) { // one shift per change, not per sample
+            srSet(alignLeds[l], on);
+            ledState[l] = on;
+        }
+    }
+}
+
+// Runs until RF3 short is pressed again; RF2 short flips the LED page.
+// The lasers stay on with every beam lit, the schedule is stopped.
+void alignmentMode(GameLane *lane) {
+    static AlignWindow windows[NUM_LANES];
+    AlignWindow *w = &windows[lane->id];
+    memset(w, 0, sizeof(*w));
+
+    bool ownLeds = ledOwner == NULL || ledOwner == lane;
+    bool ledState[ALIGN_LED_COUNT];
+    if (ownLeds) {
+        ledOwner = lane;
+        for (uint8_t l = 0; l < ALIGN_LED_COUNT; l++) {
+            savedLeds[l] = sr.get(alignLeds[l]);
+            srSet(alignLeds[l], LOW);
+            ledState[l] = false;
+        }
+    }
+
+    setLasers(lane, true);
+    beamPatternStop(lane); // every beam lit
+
+    laneLog(lane, "Alignment mode: %u samples/s, window %u samples", 1000 / ALIGN_SAMPLE_MS,
+            ALIGN_WINDOW);
+    laneLog(lane, "Per beam: %% intact | # OK  m marginal  f flickering  . dark");
+    if (ownLeds) {
+        laneLog(lane, "Status LEDs: beams 1-%u, RF2 (short press) = beams %u-%u",
+                (unsigned)ALIGN_LED_COUNT, (unsigned)ALIGN_LED_COUNT + 1, NUM_LASERS);
+    } else {
+        laneLog(lane, "Status LEDs in use by the other lane - serial stream only");
+    }
+    laneLog(lane, "RF3 (short press) = leave alignment mode");
+
+    BeamQuality quality[NUM_LASERS];
+    for (uint8_t i = 0; i < NUM_LASERS; i++) quality[i] = BEAM_DARK;
+    uint8_t page = 0;
+    uint32_t sampleCount = 0;
+    uint32_t readErrors = 0;
+    unsigned long lastReportMs = millis();
+    TickType_t lastWake = xTaskGetTickCount();
+    MainTaskMsg msg;
+
+    while (1) {
+        if (xQueueReceive(lane->queue, &msg, 0) == pdTRUE) {
+            if (msg.type == SHORT_PRESS && msg.channel == 2) break;
+            if (msg.type == SHORT_PRESS && msg.channel == 1 && ownLeds) {
+                page = (page + 1) % ALIGN_PAGES;
+                laneLog(lane, "Status LEDs: beams %u-%u", (unsigned)(page * ALIGN_LED_COUNT + 1),
+                        (unsigned)min((int)NUM_LASERS, (int)((page + 1) * ALIGN_LED_COUNT)));
+            }
+        }
+
+        uint8_t broken;
+        if (readBeams(lane, &broken)) {
+            windowPush(w, broken);
+            sampleCount++;
+        } else {
+            readErrors++;
+        }
+
+        for (uint8_t i = 0; i < NUM_LASERS; i++) {
+            BeamQuality q = classify(intactPct(w, i));
+            // Flag a beam the moment it gets worse than aligned
+            if (w->filled == ALIGN_WINDOW && q != quality[i] &&
+                (q == BEAM_MARGINAL || q == BEAM_FLICKERING)) {
+                laneLog(lane, "Beam %u %s (%u%% intact)", i + 1, qualityName[q], intactPct(w, i));
+            }
+            quality[i] = q;
+        }
+        if (ownLeds) showLeds(quality, page, ledState);
+
+        if (millis() - lastReportMs >= ALIGN_REPORT_MS) {
+            unsigned long elapsedMs = millis() - lastReportMs;
+            char codes[NUM_LASERS + 1];
+            char pcts[NUM_LASERS * 4 + 1];
+            int pos = 0;
+            for (uint8_t i = 0; i < NUM_LASERS; i++) {
+                codes[i] = qualityCode[quality[i]];
+                pos += snprintf(pcts + pos, sizeof(pcts) - pos, "%4u", intactPct(w, i));
+            }
+            codes[NUM_LASERS] = '\0';
+            laneLog(lane, "ALIGN %s |%s | %lu sps, %lu err", codes, pcts,
+                    (unsigned long)(sampleCount * 1000 / elapsedMs), (unsigned long)readErrors);
+            sampleCount = 0;
+            readErrors = 0;
+            lastReportMs = millis();
+        }
+
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(ALIGN_SAMPLE_MS));
+    }
+
+    // Summary of the last window
+    uint8_t count[BEAM_OK + 1] = {0};
+    for (uint8_t i = 0; i < NUM_LASERS; i++) {
+        count[quality[i]]++;
+        if (quality[i] != BEAM_OK) {
+            laneLog(lane, "Beam %u: %s (%u%% intact)", i + 1, qualityName[quality[i]],
+                    intactPct(w, i));
+        }
+    }
+    laneLog(lane, "Alignment done: %u OK, %u marginal, %u flickering, %u dark",
+            count[BEAM_OK], count[BEAM_MARGINAL], count[BEAM_FLICKERING], count[BEAM_DARK]);
+
+    alignmentRelease(lane);
+    flushMainTaskQueue(lane);
+}
+
+// Gives the status LEDs back if this lane holds them. Also called by
+// emergencyRestartLane(), which can kill the preparation task mid-alignment.
+void alignmentRelease(GameLane *lane) {
+    if (ledOwner != lane) return;
+    for (uint8_t l = 0; l < ALIGN_LED_COUNT; l++) srSet(alignLeds[l], savedLeds[l]);
+    ledOwner = NULL;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "globals.h"
+
+// Beam alignment mode, entered from the preparation phase (RF3 short).
+// Samples every beam at ALIGN_SAMPLE_MS and classifies it by the share of
+// intact samples over the last ALIGN_WINDOW samples.
+#define ALIGN_SAMPLE_MS     2      // 500 samples/s per lane
+#define ALIGN_WINDOW        250    // about 0.5 s of samples
+#define ALIGN_REPORT_MS     250    // serial stream period
+#define ALIGN_OK_PCT        99     // at least this intact: aligned
+#define ALIGN_MARGINAL_PCT  90     // at least this intact: marginal, below: flickering
+#define ALIGN_DARK_PCT      5      // at most this intact: not reaching the receiver
+
+enum BeamQuality { BEAM_DARK, BEAM_FLICKERING, BEAM_MARGINAL, BEAM_OK };
+
+void alignmentMode(GameLane *lane);
+void alignmentRelease(GameLane *lane);
@@ -0,0 +1,222 @@
+#include <esp_task_wdt.h>
+#include "globals.h"
+#include "functions.h"
+#include "beams.h"
+#include "supervisor.h"
+
+// --- Beam schedules ---
+static const uint8_t staticSlots[]    = {0xFF};
+static const uint8_t sweepSlots[]     = {0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC1, 0x83};
+static const uint8_t alternateSlots[] = {0x55, 0xAA};
+static const uint8_t blinkSlots[]     = {0xFF, 0x00};
+
+const BeamPattern beamPatterns[] = {
+    {"static",    staticSlots,    1, 1000, 0},
+    {"sweep",     sweepSlots,     8, 400,  60},
+    {"alternate", alternateSlots, 2, 1500, 70},
+    {"blink",     blinkSlots,     2, 1200, 50},
+};
+const uint8_t NUM_BEAM_PATTERNS = sizeof(beamPatterns) / sizeof(beamPatterns[0]);
+
+// Engine fields are shared between the pattern task and the game tasks.
+static portMUX_TYPE beamMux = portMUX_INITIALIZER_UNLOCKED;
+
+void beamEngineInit(GameLane *lane) {
+    BeamEngine *e = &lane->beams;
+    e->pattern = &beamPatterns[0];
+    e->running = false;
+    e->powered = false;
+    e->slot = 0;
+    e->slotTicksLeft = 0;
+    e->litMask = 0xFF;
+    e->armedMask = 0;
+    for (uint8_t i = 0; i < NUM_LASERS; i++) e->litSince[i] = 0;
+    e->settleMs = BEAM_SETTLE_MIN_MS;
+    e->urgency = 0;
+}
+
+// Drives the physical outputs for a lit mask. With per-beam drive every beam
+// has its own output; relay-only hardware can just switch the whole grid.
+static void writeBeamOutputs(GameLane *lane, uint8_t mask) {
+    if (lane->out.beamBase != NO_OUTPUT) {
+        srSetBeams(lane->out.beamBase, mask);
+    } else {
+        srSet(lane->out.lasers, (lane->beams.powered && mask) ? HIGH : LOW);
+    }
+}
+
+// Beams going dark are disarmed before the output changes, so the receiver
+// seeing them drop is never a break. Beams going lit start their settle time.
+static void applyBeamMask(GameLane *lane, uint8_t mask) {
+    BeamEngine *e = &lane->beams;
+    if (lane->out.beamBase == NO_OUTPUT) mask = mask ? 0xFF : 0x00;
+    TickType_t now = xTaskGetTickCount();
+    portENTER_CRITICAL(&beamMux);
+    uint8_t turnedOn = mask & ~e->litMask;
+    for (uint8_t i = 0; i < NUM_LASERS; i++) {
+        if (turnedOn & (1 << i)) e->litSince[i] = now;
+    }
+    e->armedMask &= mask;
+    e->litMask = mask;
+    portEXIT_CRITICAL(&beamMux);
+    writeBeamOutputs(lane, mask);
+}
+
+// Slot length shrinks linearly with the share of turn time already used.
+static uint16_t slotTicks(const BeamEngine *e) {
+    uint32_t ms = e->pattern->slotMs;
+    ms -= ms * e->pattern->rampPct * e->urgency / 10000;
+    uint32_t ticks = ms / BEAM_TICK_MS;
+    return ticks ? ticks : 1;
+}
+
+// Fixed-tick engine for every lane: advances running schedules and keeps
+// armedMask up to date for the detection loop.
+void beamPatternTask(void *pvParameters) {
+    TickType_t lastWake = xTaskGetTickCount();
+    esp_task_wdt_add(NULL);
+    while (1) {
+        esp_task_wdt_reset();
+        heartbeat(HB_BEAM_PATTERNS, 1000);
+        for (int l = 0; l < NUM_LANES; l++) {
+            GameLane *lane = &lanes[l];
+            BeamEngine *e = &lane->beams;
+
+            if (e->running && e->pattern != NULL) {
+                if (e->slotTicksLeft == 0) {
+                    e->slot = (e->slot + 1) % e->pattern->numSlots;
+                    applyBeamMask(lane, e->pattern->slots[e->slot]);
+                    e->slotTicksLeft = slotTicks(e);
+                }
+                e->slotTicksLeft--;
+            }
+
+            TickType_t now = xTaskGetTickCount();
+            uint8_t armed = 0;
+            portENTER_CRITICAL(&beamMux);
+            if (e->powered) {
+                for (uint8_t i = 0; i < NUM_LASERS; i++) {
+                    if ((e->litMask & (1 << i)) &&
+                        (now - e->litSince[i]) >= pdMS_TO_TICKS(e->settleMs)) {
+                        armed |= (1 << i);
+                    }
+                }
+            }
+            e->armedMask = armed;
+            portEXIT_CRITICAL(&beamMux);
+        }
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(BEAM_TICK_MS));
+    }
+}
+
+void beamPatternStart(GameLane *lane) {
+    BeamEngine *e = &lane->beams;
+    e->running = false;
+    e->slot = 0;
+    e->urgency = 0;
+    applyBeamMask(lane, e->pattern->slots[0]);
+    e->slotTicksLeft = slotTicks(e);
+    e->running = true;
+}
+
+// Stops the schedule and lights the whole grid again.
+void beamPatternStop(GameLane *lane) {
+    lane->beams.running = false;
+    applyBeamMask(lane, 0xFF);
+}
+
+// Called by setLasers(): the master relay cuts every beam at once.
+void beamPowerChanged(GameLane *lane, bool on) {
+    BeamEngine *e = &lane->beams;
+    TickType_t now = xTaskGetTickCount();
+    portENTER_CRITICAL(&beamMux);
+    if (on && !e->powered) {
+        for (uint8_t i = 0; i < NUM_LASERS; i++) e->litSince[i] = now;
+    }
+    if (!on) e->armedMask = 0;
+    e->powered = on;
+    portEXIT_CRITICAL(&beamMux);
+}
+
+uint8_t beamArmedMask(GameLane *lane) {
+    return lane->beams.armedMask;
+}
+
+// Shortest time any beam stays lit in one pass of the pattern, at the
+// fastest ramp. 0 when every beam is lit all the time.
+static uint32_t shortestLitMs(const BeamPattern *p) {
+    uint32_t fastestSlotMs = p->slotMs - p->slotMs * p->rampPct / 100;
+    uint32_t shortest = 0;
+    for (uint8_t i = 0; i < NUM_LASERS; i++) {
+        uint8_t bit = 1 << i;
+        for (uint8_t s = 0; s < p->numSlots; s++) {
+            uint8_t prev = (s + p->numSlots - 1) % p->numSlots;
+            // Start of a lit run: lit here, dark in the previous slot
+            if (!(p->slots[s] & bit) || (p->slots[prev] & bit)) continue;
+            uint8_t run = 0;
+            while (run < p->numSlots && (p->slots[(s + run) % p->numSlots] & bit)) run++;
+            uint32_t ms = run * fastestSlotMs;
+            if (shortest == 0 || ms < shortest) shortest = ms;
+        }
+    }
+    return shortest;
+}
+
+// Measures how long the receivers of the working beams take to report
+// "intact" after the beams are switched on, and sets the arming delay to
+// twice the worst case. Runs with the schedule stopped and lasers powered.
+// A beam that never settles is left out and reported. The delay is capped
+// at half the pattern's shortest lit span, so every beam can still arm,
+// but never below the worst case itself: a pattern too fast for the
+// receivers falls back to static.
+void beamCharacterizeSettle(GameLane *lane, uint8_t workingMask) {
+    const int RUNS = 5;
+    const uint32_t TIMEOUT_US = 500000;
+    uint32_t worstUs = 0;
+    uint8_t measured = workingMask;
+
+    if (workingMask == 0) return;
+    for (int run = 0; run < RUNS && measured; run++) {
+        applyBeamMask(lane, 0x00);
+        vTaskDelay(100 / portTICK_PERIOD_MS);
+        uint32_t t0 = micros();
+        applyBeamMask(lane, 0xFF);
+        uint8_t pending = measured;
+        while (pending) {
+            uint32_t elapsed = micros() - t0;
+            uint8_t state;
+            // A failed read gives no data, never a settled beam
+            if (readBeams(lane, &state)) {
+                uint8_t settled = pending & ~state;
+                if (settled && elapsed > worstUs) worstUs = elapsed;
+                pending &= ~settled;
+            }
+            if (pending && elapsed >= TIMEOUT_US) {
+                for (uint8_t i = 0; i < NUM_LASERS; i++) {
+                    if (pending & (1 << i)) {
+                        laneLog(lane, "Beam settle: beam %d not intact after %lu ms - left out",
+                                i + 1, (unsigned long)(TIMEOUT_US / 1000));
+                    }
+                }
+                measured &= ~pending;
+                break;
+            }
+        }
+    }
+
+    uint32_t floorMs = max((worstUs + 999) / 1000, (uint32_t)BEAM_SETTLE_MIN_MS);
+    uint32_t settleMs = max((2 * worstUs + 999) / 1000, (uint32_t)BEAM_SETTLE_MIN_MS);
+    uint32_t capMs = shortestLitMs(lane->beams.pattern) / 2;
+    if (capMs != 0 && floorMs > capMs) {
+        laneLog(lane, "Beam settle: %lu ms does not fit pattern %s (%lu ms lit) - using static",
+                (unsigned long)floorMs, lane->beams.pattern->name, (unsigned long)(2 * capMs));
+        lane->beams.pattern = &beamPatterns[0];
+        capMs = 0;
+    }
+    bool capped = capMs != 0 && settleMs > capMs;
+    if (capped) settleMs = capMs;
+    lane->beams.settleMs = settleMs;
+    laneLog(lane, "Beam settle: worst %lu us over %d runs -> arming delay %lu ms%s",
+            (unsigned long)worstUs, RUNS, (unsigned long)settleMs,
+            capped ? " (capped by the pattern)" : "");
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "globals.h"
+
+extern const BeamPattern beamPatterns[];
+extern const uint8_t NUM_BEAM_PATTERNS;
+
+void beamEngineInit(GameLane *lane);
+void beamPatternTask(void *pvParameters);
+void beamPatternStart(GameLane *lane);
+void beamPatternStop(GameLane *lane);
+void beamPowerChanged(GameLane *lane, bool on);
+uint8_t beamArmedMask(GameLane *lane);
+void beamCharacterizeSettle(GameLane *lane, uint8_t workingMask);
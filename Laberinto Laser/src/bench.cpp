@@ -0,0 +1,197 @@
+#ifdef BENCHMARK_BUILD
+// Microbenchmarks of the I/O primitives the game loop relies on. Built by
+// env esp32doit-devkit-v1-bench: setup() initialises the hardware as usual,
+// then runs this suite instead of the game tasks.
+//
+// Every result is one JSON line on Serial:
+//   {"bench":"pcf_read8_100k","n":200,"min_us":..,"median_us":..,"p99_us":..,"max_us":..,"errors":0}
+// Save the monitor output of two runs and compare them with
+// tools/bench_compare.py.
+#include <algorithm>
+#include "globals.h"
+#include "functions.h"
+#include "tasks.h"
+#include "beams.h"
+#include "gametimer.h"
+#include "supervisor.h"
+#include "taskmem.h"
+#include "bench.h"
+
+#define BENCH_MAX_SAMPLES 500
+#define BENCH_CHANNEL     0xFF   // RfEvent channel used by the wakeup bench
+
+static uint32_t samples[BENCH_MAX_SAMPLES];  // CPU cycles
+static uint32_t cpuMhz;
+
+static volatile uint32_t isrStampCycles;
+static hw_timer_t *wakeTimer;
+
+// Cycles as microseconds with two decimals.
+static void formatUs(char *buf, size_t len, uint32_t cycles) {
+  uint32_t centiUs = (uint32_t)((uint64_t)cycles * 100 / cpuMhz);
+  snprintf(buf, len, "%lu.%02lu", (unsigned long)(centiUs / 100), (unsigned long)(centiUs % 100));
+}
+
+static void report(const char *name, int n, uint32_t errors) {
+  std::sort(samples, samples + n);
+  char minUs[16], medianUs[16], p99Us[16], maxUs[16];
+  formatUs(minUs, sizeof(minUs), samples[0]);
+  formatUs(medianUs, sizeof(medianUs), samples[n / 2]);
+  formatUs(p99Us, sizeof(p99Us), samples[(n * 99 + 99) / 100 - 1]);
+  formatUs(maxUs, sizeof(maxUs), samples[n - 1]);
+  Serial.printf("{\"bench\":\"%s\",\"n\":%d,\"min_us\":%s,\"median_us\":%s,\"p99_us\":%s,"
+                "\"max_us\":%s,\"errors\":%lu}\n",
+                name, n, minUs, medianUs, p99Us, maxUs, (unsigned long)errors);
+}
+
+static void benchPcfRead(uint32_t clockHz, const char *name) {
+  const int n = 200;
+  uint32_t errors = 0;
+  Wire.setClock(clockHz);
+  for (int i = 0; i < n; i++) {
+    uint32_t t0 = ESP.getCycleCount();
+    pcf.read8();
+    samples[i] = ESP.getCycleCount() - t0;
+    if (pcf.lastError() != PCF8574_OK) errors++;
+  }
+  report(name, n, errors);
+}
+
+static void benchSrSet(void) {
+  const int n = BENCH_MAX_SAMPLES;
+  // Raw shift of the whole chain
+  for (int i = 0; i < n; i++) {
+    uint32_t t0 = ESP.getCycleCount();
+    sr.set(LED_WIFI, i & 1);
+    samples[i] = ESP.getCycleCount() - t0;
+  }
+  report("sr_set", n, 0);
+  // As the game calls it: mutex and bounds check included
+  for (int i = 0; i < n; i++) {
+    uint32_t t0 = ESP.getCycleCount();
+    srSet(LED_WIFI, i & 1);
+    samples[i] = ESP.getCycleCount() - t0;
+  }
+  report("srSet_locked", n, 0);
+  srSet(LED_WIFI, LOW);
+}
+
+// One play() frame. The library waits for the previous command's ACK
+// before sending, so calls are spaced out to time the frame alone.
+static void benchDfPlayer(void) {
+  const int n = 20;
+  int volume = myDFPlayer.readVolume();
+  myDFPlayer.volume(0);
+  vTaskDelay(100 / portTICK_PERIOD_MS);
+  for (int i = 0; i < n; i++) {
+    uint32_t t0 = ESP.getCycleCount();
+    myDFPlayer.play(audioTracks[8].trackNum);
+    samples[i] = ESP.getCycleCount() - t0;
+    vTaskDelay(150 / portTICK_PERIOD_MS);
+  }
+  report("dfplayer_play", n, 0);
+  myDFPlayer.stop();
+  vTaskDelay(100 / portTICK_PERIOD_MS);
+  if (volume > 0) myDFPlayer.volume(volume);
+}
+
+// Posts to rfEventQueue exactly like handle_rf_isr(). A hardware timer
+// stands in for the RF receiver, so no button has to be pressed.
+static void IRAM_ATTR benchTimerIsr(void) {
+  isrStampCycles = ESP.getCycleCount();
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+  RfEvent event;
+  event.channel = BENCH_CHANNEL;
+  event.type = SHORT_PRESS;
+  xQueueSendFromISR(rfEventQueue, &event, &xHigherPriorityTaskWoken);
+  if (xHigherPriorityTaskWoken) portYIELD_FROM_ISR();
+}
+
+static void benchIsrWakeup(void) {
+  const int n = 200;
+  uint32_t errors = 0;
+  int taken = 0;
+  RfEvent event;
+  wakeTimer = timerBegin(0, 80, true); // 1 MHz
+  timerAttachInterrupt(wakeTimer, benchTimerIsr, true);
+  xQueueReset(rfEventQueue);
+  for (int i = 0; i < n; i++) {
+    timerWrite(wakeTimer, 0);
+    timerAlarmWrite(wakeTimer, 1000, false);
+    timerAlarmEnable(wakeTimer);
+    // Same receive as rfControllerTask
+    if (xQueueReceive(rfEventQueue, &event, 100 / portTICK_PERIOD_MS) != pdTRUE) {
+      errors++;
+      continue;
+    }
+    uint32_t woke = ESP.getCycleCount();
+    if (event.channel != BENCH_CHANNEL) { // a real RF press got in
+      errors++;
+      continue;
+    }
+    samples[taken++] = woke - isrStampCycles;
+  }
+  if (taken > 0) report("isr_to_task_wakeup", taken, errors);
+}
+
+// questStep(), the penalty-free part of a questTask() loop iteration,
+// without its 50 ms sleep. The beam pattern task runs, so beams are armed
+// as in a turn. Iterations cut short by a break or an RF event count as
+// errors. Checkpoints go to scratch slots in this build (checkpoint.cpp).
+static void benchQuestIteration(void) {
+  const int n = 300;
+  uint32_t shortCut = 0;
+  GameLane *lane = &lanes[0];
+  Changeover co = {false, false};
+  QuestStep step;
+  step.playerNumber = 1;
+  step.lives = LIVES_PER_PLAYER;
+  step.limitMs = 600000;
+  step.co = &co;
+  step.workingMask = 0xFF;
+  startSystemTask(SYS_TASK_BEAMS, beamPatternTask, "Beam Patterns", 3);
+  setLasers(lane, true);
+  beamPatternStop(lane);
+  vTaskDelay(BEAM_SETTLE_MIN_MS / portTICK_PERIOD_MS);
+  // Beams broken now stay out, as in questTask
+  if (readBeams(lane, &step.pcfState)) step.workingMask = ~step.pcfState;
+  turnClockStart(lane, step.limitMs);
+  beamPatternStart(lane);
+  vTaskDelay((lane->beams.settleMs + 2 * BEAM_TICK_MS) / portTICK_PERIOD_MS);
+  step.lastCheckpointMs = millis();
+  for (int i = 0; i < n; i++) {
+    uint32_t t0 = ESP.getCycleCount();
+    QuestEvent event = questStep(lane, &step);
+    samples[i] = ESP.getCycleCount() - t0;
+    if (event != QUEST_CONTINUE) shortCut++;
+  }
+  turnClockStop(lane);
+  beamPatternStop(lane);
+  setLasers(lane, false);
+  report("quest_iteration", n, shortCut);
+}
+
+static void benchTask(void *pvParameters) {
+  cpuMhz = getCpuFrequencyMhz();
+  Serial.printf("{\"suite\":\"laberinto\",\"version\":1,\"cpu_mhz\":%lu,\"lanes\":%d,"
+                "\"built\":\"%s %s\"}\n",
+                (unsigned long)cpuMhz, NUM_LANES, __DATE__, __TIME__);
+  benchPcfRead(100000, "pcf_read8_100k");
+  benchPcfRead(400000, "pcf_read8_400k");
+  benchPcfRead(1000000, "pcf_read8_1m");   // beyond the PCF8574 spec
+  Wire.setClock(100000);                   // back to the game's bus speed
+  benchSrSet();
+  benchDfPlayer();
+  benchIsrWakeup();
+  benchQuestIteration();
+  Serial.println("{\"done\":true}");
+  vTaskSuspend(NULL);
+}
+
+// Replaces the game tasks. Runs at the RF controller's priority, in its
+// slot, so the wakeup numbers match what rfControllerTask sees.
+void benchStart(void) {
+  startSystemTask(SYS_TASK_LOG, loggerTask, "Logger", 1);
+  startSystemTask(SYS_TASK_RF, benchTask, "Bench", 2);
+}
+#endif
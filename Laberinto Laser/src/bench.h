@@ -0,0 +1,7 @@
+#pragma once
+
+// On-target microbenchmarks, built with -DBENCHMARK_BUILD
+// (env esp32doit-devkit-v1-bench). See bench.cpp.
+#ifdef BENCHMARK_BUILD
+void benchStart(void);
+#endif
@@ -0,0 +1,242 @@
+#include "globals.h"
+#include "functions.h"
+#include "beams.h"
+#include "checkpoint.h"
+#include <rom/crc.h>
+#if CHECKPOINT_NVS
+#include <Preferences.h>
+#endif
+
+#define CHECKPOINT_MAGIC 0x4C4C4350  // "PCLL"
+#define AUTO_RESUME_MARK 0x52535550  // "PUSR"
+
+// Not cleared by the startup code; the CRC tells a record from garbage.
+RTC_NOINIT_ATTR static GameCheckpoint rtcSlots[NUM_LANES][2];
+#ifdef BENCHMARK_BUILD
+// The benchmark runs fake turns through the real code. Their records go
+// here, so a session saved by the game firmware survives a benchmark run.
+static GameCheckpoint benchSlots[NUM_LANES][2];
+#define saveSlots benchSlots
+#else
+#define saveSlots rtcSlots
+#endif
+
+// AUTO_RESUME_MARK when the supervisor restarted the lane or the
+// controller, and how often that happened this session. Kept in RTC memory
+// to survive ESP.restart().
+RTC_NOINIT_ATTR static uint32_t autoResumeMark[NUM_LANES];
+RTC_NOINIT_ATTR static uint32_t autoResumeCount[NUM_LANES];
+
+// Latest record per lane, as written or loaded at boot.
+static GameCheckpoint latest[NUM_LANES];
+// Set when the operator accepted a resume into a running turn.
+static bool resumeTurn[NUM_LANES];
+
+#if CHECKPOINT_NVS
+// Opened once at boot. An NVS write replaces the blob atomically, so one
+// copy per lane is enough there.
+static Preferences nvs;
+static bool nvsReady = false;
+static const char *nvsKey(uint8_t laneId) { return laneId == 0 ? "lane0" : "lane1"; }
+#endif
+
+static uint32_t recordCrc(const GameCheckpoint *cp) {
+  return crc32_le(0, (const uint8_t *)cp, offsetof(GameCheckpoint, crc));
+}
+
+static bool recordValid(const GameCheckpoint *cp) {
+  return cp->magic == CHECKPOINT_MAGIC && cp->crc == recordCrc(cp) &&
+         cp->phase <= CP_TURN && cp->pattern < NUM_BEAM_PATTERNS;
+}
+
+static const char *resetName(esp_reset_reason_t reason) {
+  switch (reason) {
+    case ESP_RST_POWERON:  return "power-on";
+    case ESP_RST_SW:       return "software";
+    case ESP_RST_PANIC:    return "panic";
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:      return "watchdog";
+    case ESP_RST_BROWNOUT: return "brownout";
+    default:               return "other";
+  }
+}
+
+// Picks the newest valid RTC copy of each lane, falling back to NVS when
+// RTC memory was lost (power-on, brownout).
+void checkpointInit(void) {
+  esp_reset_reason_t reason = esp_reset_reason();
+  Serial.printf("Reset reason: %s\n", resetName(reason));
+#if CHECKPOINT_NVS
+  nvsReady = nvs.begin("checkpoint", false);
+#endif
+  for (uint8_t id = 0; id < NUM_LANES; id++) {
+    // RTC memory holds garbage after power-on and brownout
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT ||
+        autoResumeCount[id] > MAX_AUTO_RESUMES) {
+      autoResumeMark[id] = 0;
+      autoResumeCount[id] = 0;
+    }
+    const GameCheckpoint *best = NULL;
+    for (int s = 0; s < 2; s++) {
+      const GameCheckpoint *cp = &rtcSlots[id][s];
+      if (recordValid(cp) && (best == NULL || (int32_t)(cp->seq - best->seq) > 0)) best = cp;
+    }
+    const char *source = "RTC";
+#if CHECKPOINT_NVS
+    GameCheckpoint fromNvs;
+    if (best == NULL && nvsReady &&
+        nvs.getBytes(nvsKey(id), &fromNvs, sizeof(fromNvs)) == sizeof(fromNvs) &&
+        recordValid(&fromNvs)) {
+      best = &fromNvs;
+      source = "NVS";
+    }
+#endif
+    resumeTurn[id] = false;
+    if (best == NULL) {
+      memset(&latest[id], 0, sizeof(latest[id]));
+      latest[id].phase = CP_NONE;
+      continue;
+    }
+    latest[id] = *best;
+    if (best->phase != CP_NONE) {
+      Serial.printf("Lane %u checkpoint #%lu from %s: phase %u, player %u, lives %u, %lu ms left\n",
+                    id + 1, (unsigned long)best->seq, source, best->phase, best->playerNumber,
+                    best->lives, (unsigned long)best->remainingMs);
+    }
+  }
+}
+
+// Cheap enough for the quest loop: a 28-byte copy and a ROM CRC into RTC
+// memory. persist=true adds an NVS write, which stalls flash access for a
+// few ms and must stay out of the detection path.
+void checkpointSave(GameLane *lane, CheckpointPhase phase, int playerNumber, int lives,
+                    uint32_t remainingMs, bool persist) {
+  unsigned long startUs = micros();
+  GameCheckpoint *cp = &latest[lane->id];
+  cp->magic = CHECKPOINT_MAGIC;
+  cp->seq++;
+  cp->phase = phase;
+  cp->pattern = lane->beams.pattern - beamPatterns;
+  cp->playerNumber = playerNumber;
+  cp->lives = lives;
+  cp->gameTimeLimit = lane->gameTimeLimit;
+  cp->remainingMs = remainingMs;
+  cp->crc = recordCrc(cp);
+  // Odd and even records alternate slots; the newer one wins on boot
+  saveSlots[lane->id][cp->seq & 1] = *cp;
+#ifdef BENCHMARK_BUILD
+  persist = false;
+#endif
+  if (!persist) return;
+
+  unsigned long rtcUs = micros() - startUs;
+#if CHECKPOINT_NVS
+  if (nvsReady) nvs.putBytes(nvsKey(lane->id), cp, sizeof(*cp));
+#endif
+  laneLog(lane, "Checkpoint #%lu (phase %u, player %d, lives %d, %lu ms left): RTC %lu us, total %lu us",
+          (unsigned long)cp->seq, phase, playerNumber, lives, (unsigned long)remainingMs,
+          rtcUs, micros() - startUs);
+}
+
+// Session over: nothing left to resume.
+void checkpointClear(GameLane *lane) {
+  resumeTurn[lane->id] = false;
+  autoResumeCount[lane->id] = 0;
+  checkpointSave(lane, CP_NONE, 0, 0, 0, true);
+}
+
+// Called by the supervisor before it restarts a lane or the controller:
+// nobody asked for that restart, so the session resumes without asking.
+// After MAX_AUTO_RESUMES in one session the stall is not going away, and
+// the operator decides again.
+void checkpointAutoResume(GameLane *lane) {
+  if (autoResumeCount[lane->id] >= MAX_AUTO_RESUMES) {
+    laneLog(lane, "%d automatic resumes this session - the operator decides", MAX_AUTO_RESUMES);
+    return;
+  }
+  autoResumeCount[lane->id]++;
+  autoResumeMark[lane->id] = AUTO_RESUME_MARK;
+}
+
+// Called by mainTask when it starts, after boot or an emergency restart.
+// Blinks the green lighting while waiting. RF1 short resumes, RF3 long or
+// the timeout starts fresh. After a supervisor restart it resumes at once.
+// Returns true with lane->state set to STATE_QUEST when the session resumes.
+bool checkpointOfferResume(GameLane *lane) {
+  GameCheckpoint *cp = &latest[lane->id];
+  bool automatic = autoResumeMark[lane->id] == AUTO_RESUME_MARK;
+  autoResumeMark[lane->id] = 0;
+  if (cp->phase == CP_NONE) return false;
+
+  if (cp->phase == CP_TURN) {
+    laneLog(lane, "Unfinished session: %lu s mode, player %u, %u lives, %lu ms left",
+            (unsigned long)(cp->gameTimeLimit / 1000), cp->playerNumber, cp->lives,
+            (unsigned long)cp->remainingMs);
+  } else {
+    laneLog(lane, "Unfinished session: %lu s mode, quest not started",
+            (unsigned long)(cp->gameTimeLimit / 1000));
+  }
+  bool resume = automatic;
+  bool decided = automatic;
+  if (automatic) {
+    laneLog(lane, "Restarted by the supervisor - resuming without asking");
+  } else {
+    laneLog(lane, "RF1 (short press) = resume, RF3 (long press) = fresh start");
+  }
+  flushMainTaskQueue(lane);
+
+  bool lit = false;
+  unsigned long offerStart = millis();
+  MainTaskMsg msg;
+  while (!decided && millis() - offerStart < RESUME_OFFER_MS) {
+    lit = !lit;
+    setGreenLighting(lane, lit);
+    if (xQueueReceive(lane->queue, &msg, 250 / portTICK_PERIOD_MS) == pdTRUE) {
+      if (msg.channel == 0 && msg.type == SHORT_PRESS) {
+        resume = true;
+        decided = true;
+      } else if (msg.channel == 2 && msg.type == LONG_PRESS) {
+        decided = true;
+      }
+    }
+  }
+  setGreenLighting(lane, false);
+  flushMainTaskQueue(lane);
+
+  if (!resume) {
+    laneLog(lane, decided ? "Checkpoint discarded - fresh start"
+                          : "No answer - checkpoint discarded, fresh start");
+    checkpointClear(lane);
+    return false;
+  }
+
+  // Preparation is skipped: put the beam inputs back in input mode
+  xSemaphoreTake(lane->ioMutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < NUM_LASERS; i++) {
+    lane->pcf->write(i, HIGH);
+  }
+  xSemaphoreGive(lane->ioMutex);
+  lane->gameTimeLimit = cp->gameTimeLimit;
+  lane->beams.pattern = &beamPatterns[cp->pattern];
+  lane->systemReady = true;
+  resumeTurn[lane->id] = cp->phase == CP_TURN;
+  lane->state = STATE_QUEST;
+  laneLog(lane, "Resuming session (checkpoint #%lu)", (unsigned long)cp->seq);
+  return true;
+}
+
+// Hands the accepted turn to questTask once. A turn that was already lost
+// or out of time resumes with the next player.
+bool checkpointTakeResume(GameLane *lane, GameCheckpoint *cp) {
+  if (!resumeTurn[lane->id]) return false;
+  resumeTurn[lane->id] = false;
+  *cp = latest[lane->id];
+  if (cp->lives == 0 || cp->remainingMs == 0 || cp->lives > LIVES_PER_PLAYER) {
+    cp->playerNumber++;
+    cp->lives = LIVES_PER_PLAYER;
+    cp->remainingMs = cp->gameTimeLimit;
+  }
+  if (cp->remainingMs > cp->gameTimeLimit) cp->remainingMs = cp->gameTimeLimit;
+  return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "globals.h"
+
+// Snapshot of one lane's session, written at phase boundaries, life changes
+// and once a second during a turn, so a reset mid-session can resume.
+//
+// Two copies per lane live in RTC memory, written alternately with a
+// sequence number and CRC: a reset in the middle of a write leaves the
+// other copy intact. RTC memory survives software, panic and watchdog
+// resets but not a brownout, so records written with persist=true (never
+// during detection) are also mirrored to NVS.
+#ifndef CHECKPOINT_NVS
+#define CHECKPOINT_NVS 1
+#endif
+
+// How long the resume offer waits for the operator before a fresh start.
+#define RESUME_OFFER_MS 30000
+// Supervisor restarts per session that resume without the offer.
+#define MAX_AUTO_RESUMES 3
+
+enum CheckpointPhase : uint8_t {
+  CP_NONE,    // nothing to resume
+  CP_READY,   // time mode chosen, quest not started yet
+  CP_TURN     // in the quest: player, lives and time left are valid
+};
+
+struct GameCheckpoint {
+  uint32_t magic;
+  uint32_t seq;
+  uint8_t phase;            // CheckpointPhase
+  uint8_t pattern;          // index into beamPatterns
+  uint8_t playerNumber;
+  uint8_t lives;
+  uint32_t gameTimeLimit;
+  uint32_t remainingMs;     // time left in the player's turn
+  uint32_t crc;             // over everything above, written last
+};
+
+void checkpointInit(void);
+void checkpointSave(GameLane *lane, CheckpointPhase phase, int playerNumber, int lives,
+                    uint32_t remainingMs, bool persist);
+void checkpointClear(GameLane *lane);
+void checkpointAutoResume(GameLane *lane);
+bool checkpointOfferResume(GameLane *lane);
+bool checkpointTakeResume(GameLane *lane, GameCheckpoint *cp);
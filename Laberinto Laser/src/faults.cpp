@@ -0,0 +1,104 @@
+#include "globals.h"
+#include "functions.h"
+#include "faults.h"
+
+#ifdef FAULT_INJECTION
+
+static volatile uint32_t nackUntilMs = 0;
+static volatile uint8_t stuckBeams[NUM_LANES] = {0};
+static volatile bool audioMuted = false;
+static volatile uint32_t hangMs[NUM_LANES] = {0};
+static volatile uint32_t injectedAtMs = 0;
+
+static void injected(const char *what) {
+    injectedAtMs = millis();
+    char line[64];
+    snprintf(line, sizeof(line), "FAULT injected: %s", what);
+    logWrite(line);
+}
+
+static GameLane *laneArg(int laneNum) {
+    if (laneNum < 1 || laneNum > NUM_LANES) return NULL;
+    return &lanes[laneNum - 1];
+}
+
+// Parses "<word> [a] [b]" without sscanf, which is heavy on the 2 KB
+// supervisor stack.
+static void handleCommand(char *cmd) {
+    char *rest = cmd;
+    while (*rest && *rest != ' ') rest++;
+    if (*rest) *rest++ = '\0';
+    char *end;
+    long a = strtol(rest, &end, 10);
+    long b = strtol(end, NULL, 10);
+
+    if (strcmp(cmd, "nack") == 0 && a > 0) {
+        nackUntilMs = millis() + a;
+        injected("nack");
+    } else if (strcmp(cmd, "stuck") == 0 && laneArg(a) && b >= 1 && b <= NUM_LASERS) {
+        stuckBeams[a - 1] |= (1 << (b - 1));
+        injected("stuck beam");
+    } else if (strcmp(cmd, "mute") == 0) {
+        audioMuted = true;
+        injected("mute");
+    } else if (strcmp(cmd, "unmute") == 0) {
+        audioMuted = false;
+        logWrite("FAULT cleared: mute");
+    } else if (strcmp(cmd, "hang") == 0 && laneArg(a) && b > 0) {
+        hangMs[a - 1] = b;
+        injected("hang");
+    } else if (strcmp(cmd, "clear") == 0) {
+        nackUntilMs = 0;
+        audioMuted = false;
+        for (int i = 0; i < NUM_LANES; i++) {
+            stuckBeams[i] = 0;
+            hangMs[i] = 0;
+        }
+        logWrite("FAULT cleared: all");
+    } else {
+        logWrite("FAULT commands: nack <ms> | stuck <lane> <beam> | mute | unmute | hang <lane> <ms> | clear");
+    }
+}
+
+// Non-blocking line reader, called from the supervisor loop.
+void faultPollSerial(void) {
+    static char buf[48];
+    static uint8_t len = 0;
+    while (Serial.available() > 0) {
+        char c = Serial.read();
+        if (c == '\r') continue;
+        if (c == '\n') {
+            buf[len] = '\0';
+            if (len > 0) handleCommand(buf);
+            len = 0;
+        } else if (len < sizeof(buf) - 1) {
+            buf[len++] = c;
+        }
+    }
+}
+
+bool faultI2cNack(void) {
+    return (int32_t)(nackUntilMs - millis()) > 0;
+}
+
+uint8_t faultStuckBeams(GameLane *lane) {
+    return stuckBeams[lane->id];
+}
+
+bool faultAudioMuted(void) {
+    return audioMuted;
+}
+
+uint32_t faultTakeHang(GameLane *lane) {
+    uint32_t ms = hangMs[lane->id];
+    hangMs[lane->id] = 0;
+    return ms;
+}
+
+void faultRecovered(GameLane *lane, const char *what) {
+    if (injectedAtMs == 0) return;
+    laneLog(lane, "FAULT recovered (%s) %lu ms after injection", what,
+            (unsigned long)(millis() - injectedAtMs));
+}
+
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+#include "globals.h"
+
+// Fault injection for recovery testing, built with -DFAULT_INJECTION
+// (env esp32doit-devkit-v1-faults). Commands are read from Serial by the
+// supervisor, one per line:
+//   nack <ms>           every PCF8574 read fails for <ms>
+//   stuck <lane> <beam> beam reads broken until "clear" (1-based numbers)
+//   mute / unmute       DFPlayer commands are dropped
+//   hang <lane> <ms>    the lane's quest loop blocks for <ms>
+//   clear               remove all faults
+// faultRecovered() logs the time from injection to a recovery point.
+
+#ifdef FAULT_INJECTION
+void faultPollSerial(void);
+bool faultI2cNack(void);
+uint8_t faultStuckBeams(GameLane *lane);
+bool faultAudioMuted(void);
+uint32_t faultTakeHang(GameLane *lane);
+void faultRecovered(GameLane *lane, const char *what);
+#else
+inline void faultPollSerial(void) {}
+inline bool faultI2cNack(void) { return false; }
+inline uint8_t faultStuckBeams(GameLane *) { return 0; }
+inline bool faultAudioMuted(void) { return false; }
+inline uint32_t faultTakeHang(GameLane *) { return 0; }
+inline void faultRecovered(GameLane *, const char *) {}
+#endif
@@ -1,47 +1,179 @@
 #include "globals.h"
 #include "isr.h"
 #include "functions.h"
+#include "beams.h"
+#include "taskmem.h"
+#include "faults.h"
 
 esp_err_t gpio_declarations(void) {
-  for (int i = 0; i < 4; i++) {
+  for (int i = 0; i < NUM_RF_CHANNELS; i++) {
     pinMode(rfPins[i], INPUT);
+    attachInterruptArg(digitalPinToInterrupt(rfPins[i]), rf_isr, (void *)(intptr_t)i, CHANGE);
   }
-  attachInterrupt(digitalPinToInterrupt(rfPins[0]), rf_isr0, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(rfPins[1]), rf_isr1, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(rfPins[2]), rf_isr2, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(rfPins[3]), rf_isr3, CHANGE);
   return ESP_OK;
 }
 
-void playAudioInterrupt(uint8_t trackIdx) {
-    myDFPlayer.stop();
+// The shift register chain is shared by every lane, and set() rewrites the
+// whole chain, so writes are serialized.
+void srSet(uint8_t output, uint8_t value) {
+  if (output >= SR_OUTPUTS) return;
+  xSemaphoreTake(srMutex, portMAX_DELAY);
+  sr.set(output, value);
+  xSemaphoreGive(srMutex);
+}
+
+// Writes one 8-beam stage with a single shift of the chain.
+void srSetBeams(uint8_t base, uint8_t mask) {
+  if (base + NUM_LASERS > SR_OUTPUTS) return;
+  xSemaphoreTake(srMutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < NUM_LASERS; i++) {
+    sr.setNoUpdate(base + i, (mask & (1 << i)) ? HIGH : LOW);
+  }
+  sr.updateRegisters();
+  xSemaphoreGive(srMutex);
+}
+
+void playAudioInterrupt(GameLane *lane, uint8_t trackIdx) {
+    if (faultAudioMuted()) return;
+    xSemaphoreTake(lane->ioMutex, portMAX_DELAY);
+    lane->player->stop();
+    xSemaphoreGive(lane->ioMutex);
     vTaskDelay(100 / portTICK_PERIOD_MS); // Ensure stop
-    myDFPlayer.play(audioTracks[trackIdx].trackNum);
+    playTrack(lane, audioTracks[trackIdx].trackNum);
+}
+
+// Starts a track by its file number, without stopping the current one.
+// Every DFPlayer play goes through here or playAudioInterrupt(), so the
+// mute fault covers all of them.
+void playTrack(GameLane *lane, uint8_t trackNum) {
+    if (faultAudioMuted()) return;
+    xSemaphoreTake(lane->ioMutex, portMAX_DELAY);
+    lane->player->play(trackNum);
+    xSemaphoreGive(lane->ioMutex);
 }
 
-void setRedLighting(bool on)   { sr.set(k1, on ? HIGH : LOW); }
-void setGreenLighting(bool on) { sr.set(k2, on ? HIGH : LOW); }
-void setLasers(bool on)        { sr.set(k3, on ? HIGH : LOW); }
+void setRedLighting(GameLane *lane, bool on)   { srSet(lane->out.redLighting, on ? HIGH : LOW); }
+void setGreenLighting(GameLane *lane, bool on) { srSet(lane->out.greenLighting, on ? HIGH : LOW); }
 
-void blinkLasers(int times, int delayMs) {
+// k3 is the master laser relay. Beams are disarmed before it opens and
+// start their settle time once it closes.
+void setLasers(GameLane *lane, bool on) {
+    if (!on) beamPowerChanged(lane, false);
+    srSet(lane->out.lasers, on ? HIGH : LOW);
+    if (on) beamPowerChanged(lane, true);
+}
+
+void blinkLasers(GameLane *lane, int times, int delayMs) {
     for (int i = 0; i < times; ++i) {
-        setLasers(false);
+        setLasers(lane, false);
         vTaskDelay(delayMs / portTICK_PERIOD_MS);
-        setLasers(true);
+        setLasers(lane, true);
         vTaskDelay(delayMs / portTICK_PERIOD_MS);
     }
 }
-/*
-void clearMainTaskQueue() {
+
+void flushMainTaskQueue(GameLane *lane) {
     MainTaskMsg dummyMsg;
-    while (uxQueueMessagesWaiting(mainTaskQueue) > 0) {
-        xQueueReceive(mainTaskQueue, &dummyMsg, 0);
+    while (uxQueueMessagesWaiting(lane->queue) > 0) {
+        xQueueReceive(lane->queue, &dummyMsg, 0);
     }
-} */
+}
 
-void flushMainTaskQueue() {
-    MainTaskMsg dummyMsg;
-    while (uxQueueMessagesWaiting(mainTaskQueue) > 0) {
-        xQueueReceive(mainTaskQueue, &dummyMsg, 0);
+static volatile uint32_t droppedLogLines = 0;
+
+// Queues one line for loggerTask. Never blocks: when the pool is full the
+// line is dropped and counted, so logging can't stall a game loop.
+void logWrite(const char *text) {
+    LogLine line;
+    strncpy(line.text, text, sizeof(line.text) - 1);
+    line.text[sizeof(line.text) - 1] = '\0';
+    if (xQueueSend(logQueue, &line, 0) != pdTRUE) {
+        droppedLogLines++;
     }
-}
\ No newline at end of file
+}
+
+// Drains the log pool to Serial.
+void loggerTask(void *pvParameters) {
+    LogLine line;
+    uint32_t reportedDrops = 0;
+    while (1) {
+        if (xQueueReceive(logQueue, &line, portMAX_DELAY) == pdTRUE) {
+            Serial.println(line.text);
+        }
+        if (droppedLogLines != reportedDrops) {
+            Serial.print("(log lines dropped: ");
+            Serial.print((int)(droppedLogLines - reportedDrops));
+            Serial.println(")");
+            reportedDrops = droppedLogLines;
+        }
+    }
+}
+
+// Log line tagged with the lane number when more than one lane runs.
+void laneLog(GameLane *lane, const char *fmt, ...) {
+    char buf[LOG_LINE_LEN];
+    int prefix = 0;
+#if NUM_LANES > 1
+    prefix = snprintf(buf, sizeof(buf), "[L%u] ", lane->id + 1);
+#endif
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf + prefix, sizeof(buf) - prefix, fmt, args);
+    va_end(args);
+    logWrite(buf);
+}
+
+// Per-turn quest loop cost. The loop period is 50 ms, so headroom is the
+// share of that period left for other lanes on the same core. Every lane's
+// quest loop runs on core 1, so the last average of each lane is kept for
+// the combined figure.
+static uint32_t lastLoopAvgUs[NUM_LANES];
+
+void reportLoopStats(GameLane *lane) {
+    if (lane->loopCount == 0) return;
+    uint32_t avgUs = lane->loopTotalUs / lane->loopCount;
+    uint32_t headroom = avgUs >= 50000 ? 0 : (50000 - avgUs) * 100 / 50000;
+    laneLog(lane, "Quest loop: %lu iterations, avg %lu us, max %lu us, headroom %lu%%",
+            (unsigned long)lane->loopCount, (unsigned long)avgUs,
+            (unsigned long)lane->loopMaxUs, (unsigned long)headroom);
+
+    // A break on an armed beam happens at worst just after a sample. The
+    // next one comes after the 50 ms sleep and, at most, one full
+    // iteration. A beam that has just been lit is blind for its settle time
+    // plus one engine tick before that.
+    uint32_t detectMs = 50 + (lane->loopMaxUs + 999) / 1000;
+    laneLog(lane, "Break detection: worst %lu ms on an armed beam, +%lu ms after a beam lights",
+            (unsigned long)detectMs,
+            (unsigned long)(lane->beams.settleMs + BEAM_TICK_MS));
+
+    lastLoopAvgUs[lane->id] = avgUs;
+#if NUM_LANES > 1
+    uint32_t totalUs = 0;
+    for (int l = 0; l < NUM_LANES; l++) totalUs += lastLoopAvgUs[l];
+    laneLog(lane, "Quest loops, all lanes: %lu us per 50 ms period, %lu.%lu%% of core 1",
+            (unsigned long)totalUs, (unsigned long)(totalUs / 500),
+            (unsigned long)(totalUs % 500 / 50));
+#endif
+
+    lane->loopCount = 0;
+    lane->loopTotalUs = 0;
+    lane->loopMaxUs = 0;
+}
+
+// Changeover: from the end of one turn to the start of the next player's
+// clock, i.e. the dead time between two players.
+void recordChangeover(GameLane *lane, uint32_t ms) {
+    if (lane->changeoverCount == 0 || ms < lane->changeoverMinMs) lane->changeoverMinMs = ms;
+    if (ms > lane->changeoverMaxMs) lane->changeoverMaxMs = ms;
+    lane->changeoverCount++;
+    lane->changeoverTotalMs += ms;
+    laneLog(lane, "Changeover: %lu ms", (unsigned long)ms);
+}
+
+void reportChangeoverStats(GameLane *lane) {
+    if (lane->changeoverCount == 0) return;
+    laneLog(lane, "Session changeovers: %lu, avg %lu ms, min %lu ms, max %lu ms",
+            (unsigned long)lane->changeoverCount,
+            (unsigned long)(lane->changeoverTotalMs / lane->changeoverCount),
+            (unsigned long)lane->changeoverMinMs, (unsigned long)lane->changeoverMaxMs);
+}
@@ -1,9 +1,19 @@
 #pragma once
 #include <Arduino.h>
+#include "globals.h"
 esp_err_t gpio_declarations(void);
-void playAudioInterrupt(uint8_t trackIdx);
-void setRedLighting(bool on);  
-void setGreenLighting(bool on);
-void setLasers(bool on);
-void blinkLasers(int times, int delayMs = 200);
-void flushMainTaskQueue();
\ No newline at end of file
+void srSet(uint8_t output, uint8_t value);
+void srSetBeams(uint8_t base, uint8_t mask);
+void playAudioInterrupt(GameLane *lane, uint8_t trackIdx);
+void playTrack(GameLane *lane, uint8_t trackNum);
+void setRedLighting(GameLane *lane, bool on);
+void setGreenLighting(GameLane *lane, bool on);
+void setLasers(GameLane *lane, bool on);
+void blinkLasers(GameLane *lane, int times, int delayMs = 200);
+void flushMainTaskQueue(GameLane *lane);
+void logWrite(const char *text);
+void loggerTask(void *pvParameters);
+void laneLog(GameLane *lane, const char *fmt, ...);
+void reportLoopStats(GameLane *lane);
+void recordChangeover(GameLane *lane, uint32_t ms);
+void reportChangeoverStats(GameLane *lane);
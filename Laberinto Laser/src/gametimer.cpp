@@ -0,0 +1,210 @@
+#include "globals.h"
+#include "functions.h"
+#include "gametimer.h"
+
+const uint32_t turnMilestonesMs[NUM_TURN_MILESTONES] = {30000, 10000};
+
+// Clock fields are shared between the game task and the esp_timer task.
+static portMUX_TYPE clockMux = portMUX_INITIALIZER_UNLOCKED;
+
+esp_timer_handle_t gameTimerCreate(const char *name, esp_timer_cb_t callback, void *arg) {
+    esp_timer_create_args_t args = {};
+    args.callback = callback;
+    args.arg = arg;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = name;
+    esp_timer_handle_t timer = NULL;
+    // Allocated once per lane at boot, never released
+    if (esp_timer_create(&args, &timer) != ESP_OK) {
+        Serial.printf("esp_timer_create failed for %s\n", name);
+    }
+    return timer;
+}
+
+// Restarting an armed timer is allowed: the old deadline is dropped.
+void gameTimerStartOnce(esp_timer_handle_t timer, uint32_t ms) {
+    esp_timer_stop(timer);
+    esp_timer_start_once(timer, (uint64_t)ms * 1000);
+}
+
+void gameTimerStartPeriodic(esp_timer_handle_t timer, uint32_t ms) {
+    esp_timer_stop(timer);
+    esp_timer_start_periodic(timer, (uint64_t)ms * 1000);
+}
+
+void gameTimerStop(esp_timer_handle_t timer) {
+    esp_timer_stop(timer); // ESP_ERR_INVALID_STATE if not armed, harmless
+}
+
+// --- Turn clock ---
+
+static int64_t usedUsLocked(const TurnClock *c, int64_t now) {
+    return c->consumedUs + (c->running ? now - c->segmentStartUs : 0);
+}
+
+// Arms the one-shot timer for whichever comes first: the next milestone
+// or the timeout. Caller must not hold clockMux.
+static void scheduleNextDeadline(TurnClock *c) {
+    int64_t now = esp_timer_get_time();
+    int64_t waitUs;
+    portENTER_CRITICAL(&clockMux);
+    if (!c->running || c->expired) {
+        portEXIT_CRITICAL(&clockMux);
+        return;
+    }
+    int64_t remainingUs = c->limitUs - usedUsLocked(c, now);
+    waitUs = remainingUs;
+    while (c->nextMilestone < NUM_TURN_MILESTONES) {
+        int64_t milestoneUs = (int64_t)turnMilestonesMs[c->nextMilestone] * 1000;
+        if (milestoneUs < c->limitUs && milestoneUs < remainingUs) {
+            waitUs = remainingUs - milestoneUs;
+            break;
+        }
+        c->nextMilestone++; // already passed, or longer than the turn
+    }
+    portEXIT_CRITICAL(&clockMux);
+    esp_timer_stop(c->timer);
+    esp_timer_start_once(c->timer, waitUs > 0 ? waitUs : 1);
+}
+
+static void turnClockCallback(void *arg) {
+    GameLane *lane = (GameLane *)arg;
+    TurnClock *c = &lane->clock;
+    int64_t now = esp_timer_get_time();
+    bool wake = false;
+
+    portENTER_CRITICAL(&clockMux);
+    if (!c->running || c->expired) {
+        // Paused or stopped while this callback was pending
+        portEXIT_CRITICAL(&clockMux);
+        return;
+    }
+    int64_t remainingUs = c->limitUs - usedUsLocked(c, now);
+    if (remainingUs <= 0) {
+        c->expired = true;
+        c->lateUs = -remainingUs;
+        c->consumedUs = c->limitUs;
+        c->running = false;
+        wake = true;
+    } else if (c->nextMilestone < NUM_TURN_MILESTONES &&
+               remainingUs <= (int64_t)turnMilestonesMs[c->nextMilestone] * 1000) {
+        c->pendingMilestones |= (1 << c->nextMilestone);
+        c->nextMilestone++;
+        wake = true;
+    }
+    TaskHandle_t notifyTask = c->notifyTask;
+    portEXIT_CRITICAL(&clockMux);
+
+    if (wake && notifyTask != NULL) xTaskNotifyGive(notifyTask);
+    scheduleNextDeadline(c);
+}
+
+static void flashOffCallback(void *arg) {
+    setRedLighting((GameLane *)arg, false);
+}
+
+void turnClockInit(GameLane *lane) {
+    TurnClock *c = &lane->clock;
+    c->timer = gameTimerCreate("turnClock", turnClockCallback, lane);
+    c->flashTimer = gameTimerCreate("turnFlash", flashOffCallback, lane);
+    c->limitUs = 0;
+    c->consumedUs = 0;
+    c->segmentStartUs = 0;
+    c->running = false;
+    c->expired = false;
+    c->lateUs = 0;
+    c->nextMilestone = 0;
+    c->pendingMilestones = 0;
+    c->notifyTask = NULL;
+}
+
+// Starts a turn, fresh or with usedMs already gone (resumed from a
+// checkpoint). The calling task is woken on timeout and milestones.
+void turnClockStart(GameLane *lane, uint32_t limitMs, uint32_t usedMs) {
+    TurnClock *c = &lane->clock;
+    gameTimerStop(c->timer);
+    portENTER_CRITICAL(&clockMux);
+    c->limitUs = (int64_t)limitMs * 1000;
+    c->consumedUs = (int64_t)min(usedMs, limitMs) * 1000;
+    c->segmentStartUs = esp_timer_get_time();
+    c->running = true;
+    c->expired = false;
+    c->lateUs = 0;
+    c->nextMilestone = 0;
+    c->pendingMilestones = 0;
+    c->notifyTask = xTaskGetCurrentTaskHandle();
+    portEXIT_CRITICAL(&clockMux);
+    scheduleNextDeadline(c);
+}
+
+void turnClockPause(GameLane *lane) {
+    TurnClock *c = &lane->clock;
+    portENTER_CRITICAL(&clockMux);
+    if (c->running) {
+        c->consumedUs += esp_timer_get_time() - c->segmentStartUs;
+        c->running = false;
+    }
+    portEXIT_CRITICAL(&clockMux);
+    gameTimerStop(c->timer);
+}
+
+void turnClockResume(GameLane *lane) {
+    TurnClock *c = &lane->clock;
+    portENTER_CRITICAL(&clockMux);
+    bool resumed = !c->running && !c->expired && c->limitUs > 0;
+    if (resumed) {
+        c->segmentStartUs = esp_timer_get_time();
+        c->running = true;
+    }
+    portEXIT_CRITICAL(&clockMux);
+    if (resumed) scheduleNextDeadline(c);
+}
+
+// Freezes the clock at its current value; elapsed time stays readable.
+void turnClockStop(GameLane *lane) {
+    turnClockPause(lane);
+    portENTER_CRITICAL(&clockMux);
+    lane->clock.notifyTask = NULL;
+    portEXIT_CRITICAL(&clockMux);
+}
+
+bool turnClockExpired(GameLane *lane) {
+    return lane->clock.expired;
+}
+
+uint32_t turnClockElapsedMs(GameLane *lane) {
+    TurnClock *c = &lane->clock;
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&clockMux);
+    int64_t usedUs = usedUsLocked(c, now);
+    portEXIT_CRITICAL(&clockMux);
+    if (usedUs > c->limitUs) usedUs = c->limitUs;
+    return (uint32_t)(usedUs / 1000);
+}
+
+uint32_t turnClockRemainingMs(GameLane *lane) {
+    return (uint32_t)(lane->clock.limitUs / 1000) - turnClockElapsedMs(lane);
+}
+
+// Returns the index of a milestone that fired since the last call, or -1.
+int turnClockTakeMilestone(GameLane *lane) {
+    TurnClock *c = &lane->clock;
+    int taken = -1;
+    portENTER_CRITICAL(&clockMux);
+    for (int i = 0; i < NUM_TURN_MILESTONES; i++) {
+        if (c->pendingMilestones & (1 << i)) {
+            c->pendingMilestones &= ~(1 << i);
+            taken = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&clockMux);
+    return taken;
+}
+
+// Red lighting on for a moment, switched off by a one-shot timer so the
+// game loop never waits for it.
+void turnWarningFlash(GameLane *lane, uint32_t ms) {
+    setRedLighting(lane, true);
+    gameTimerStartOnce(lane->clock.flashTimer, ms);
+}
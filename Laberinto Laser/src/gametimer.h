@@ -0,0 +1,20 @@
+#pragma once
+#include "globals.h"
+
+// Thin esp_timer wrappers: callbacks run in the esp_timer task, so they may
+// block briefly (e.g. srSet) but must not wait on the game.
+esp_timer_handle_t gameTimerCreate(const char *name, esp_timer_cb_t callback, void *arg);
+void gameTimerStartOnce(esp_timer_handle_t timer, uint32_t ms);
+void gameTimerStartPeriodic(esp_timer_handle_t timer, uint32_t ms);
+void gameTimerStop(esp_timer_handle_t timer);
+
+void turnClockInit(GameLane *lane);
+void turnClockStart(GameLane *lane, uint32_t limitMs, uint32_t usedMs = 0);
+void turnClockPause(GameLane *lane);
+void turnClockResume(GameLane *lane);
+void turnClockStop(GameLane *lane);
+bool turnClockExpired(GameLane *lane);
+uint32_t turnClockElapsedMs(GameLane *lane);
+uint32_t turnClockRemainingMs(GameLane *lane);
+int turnClockTakeMilestone(GameLane *lane);
+void turnWarningFlash(GameLane *lane, uint32_t ms);
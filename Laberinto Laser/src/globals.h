@@ -3,34 +3,168 @@
 #include <ShiftRegister74HC595.h>
 #include <DFRobotDFPlayerMini.h>
 #include <PCF8574.h>
+#include <esp_timer.h>
 
+// Number of independent mazes (lanes) run by this controller.
+// Override with -DNUM_LANES=2 in platformio.ini for twin-lane venues.
+// Each lane needs its own DFPlayer UART and the ESP32 only has UART1/UART2
+// free (UART0 is Serial), so two lanes is the hardware limit.
+#ifndef NUM_LANES
+#define NUM_LANES 1
+#endif
+static_assert(NUM_LANES >= 1 && NUM_LANES <= 2, "NUM_LANES must be 1 or 2");
 
-extern const int rfPins[4];
+#define RF_CHANNELS_PER_LANE 4
+#define NUM_RF_CHANNELS (NUM_LANES * RF_CHANNELS_PER_LANE)
+
+// Per-beam laser drive: one extra 74HC595 stage per lane, one output per
+// beam, all gated by the lane's k3 master relay. Without it the pattern
+// engine can only switch the whole grid through k3.
+#ifndef PER_BEAM_LASERS
+#define PER_BEAM_LASERS 0
+#endif
+
+// Every extra lane adds one 74HC595 stage for its relays, and per-beam
+// drive adds one stage per lane after those.
+#define SR_CHIPS (1 + NUM_LANES + (PER_BEAM_LASERS ? NUM_LANES : 0))
+#define SR_OUTPUTS (SR_CHIPS * 8)
+#define SR_BEAM_BASE(laneId) ((1 + NUM_LANES + (laneId)) * 8)
+#define NO_OUTPUT 0xFF
+
+extern const int rfPins[NUM_RF_CHANNELS];
 extern const unsigned long LONG_PRESS_MS;
 extern QueueHandle_t rfEventQueue;
-extern QueueHandle_t mainTaskQueue;
-extern ShiftRegister74HC595<2> sr;
+extern ShiftRegister74HC595<SR_CHIPS> sr;
+extern SemaphoreHandle_t srMutex;
 extern HardwareSerial myDFPlayerSerial;
 extern DFRobotDFPlayerMini myDFPlayer;
 extern PCF8574 pcf;
+#if NUM_LANES > 1
+extern HardwareSerial myDFPlayerSerial2;
+extern DFRobotDFPlayerMini myDFPlayer2;
+extern PCF8574 pcf2;
+#endif
 
 enum RfEventType { SHORT_PRESS, LONG_PRESS };
 struct RfEvent {
-  uint8_t channel;
+  uint8_t channel;   // global channel, 0..NUM_RF_CHANNELS-1
   RfEventType type;
 };
 struct MainTaskMsg {
-  uint8_t channel;
+  uint8_t channel;   // lane-local channel, 0..RF_CHANNELS_PER_LANE-1
   RfEventType type;
 };
 
-extern volatile unsigned long pressStart[4];
-extern volatile bool pressed[4];
+extern volatile unsigned long pressStart[NUM_RF_CHANNELS];
+extern volatile bool pressed[NUM_RF_CHANNELS];
+// Set by setup() once the DFPlayers are initialised.
+extern volatile bool audioReady;
+
+// Game states for main task coordination
+enum GameState {
+    STATE_IDLE,        // Waiting for initial start
+    STATE_PREPARATION,
+    STATE_QUEST,
+    STATE_CONSEQUENCE
+};
+
+// Shift register outputs driven by one lane.
+struct LaneOutputs {
+  uint8_t redLighting;
+  uint8_t greenLighting;
+  uint8_t lasers;
+  uint8_t beamBase;   // first per-beam output, NO_OUTPUT when relay-only
+};
+
+#define NUM_LASERS 8
+#define LIVES_PER_PLAYER 3
+
+// Beam pattern engine (beams.cpp) ticks every BEAM_TICK_MS.
+#define BEAM_TICK_MS 5
+// Lower bound for the delay between lighting a beam and trusting its
+// receiver. The measured value from beamCharacterizeSettle() can raise it.
+#define BEAM_SETTLE_MIN_MS 10
+
+// Time-sliced beam schedule: slot i lights the beams in slots[i].
+struct BeamPattern {
+  const char *name;
+  const uint8_t *slots;
+  uint8_t numSlots;
+  uint16_t slotMs;   // slot length at the start of a turn
+  uint8_t rampPct;   // how much shorter slots get when the time runs out
+};
+
+struct BeamEngine {
+  const BeamPattern *pattern;
+  volatile bool running;
+  bool powered;                    // k3 master relay state
+  uint8_t slot;
+  uint16_t slotTicksLeft;
+  uint8_t litMask;                 // beams switched on by the schedule
+  volatile uint8_t armedMask;      // lit and settled: may cost a life
+  TickType_t litSince[NUM_LASERS];
+  uint16_t settleMs;
+  volatile uint8_t urgency;        // 0..100, share of turn time used
+};
+
+// Remaining-time warnings, largest first.
+#define NUM_TURN_MILESTONES 2
+extern const uint32_t turnMilestonesMs[NUM_TURN_MILESTONES];
+
+// Turn timer on esp_timer (gametimer.cpp). Counts only while running, so
+// penalties can pause it, and fires its deadline independently of the
+// quest loop.
+struct TurnClock {
+  esp_timer_handle_t timer;
+  int64_t limitUs;
+  int64_t consumedUs;              // time used before the current segment
+  int64_t segmentStartUs;          // esp_timer time the segment started
+  bool running;
+  volatile bool expired;
+  volatile int64_t lateUs;         // timeout callback lateness
+  uint8_t nextMilestone;           // index into turnMilestonesMs
+  volatile uint8_t pendingMilestones;  // bit i: milestone i fired, not yet seen
+  TaskHandle_t notifyTask;         // woken on timeout and milestones
+  esp_timer_handle_t flashTimer;   // ends the milestone warning flash
+};
+
+// One maze. Holds everything the game tasks used to keep in file-scope
+// globals, so several lanes can run side by side with independent timers
+// and lives. Tasks receive a GameLane* through pvParameters.
+struct GameLane {
+  uint8_t id;                        // 0-based lane index
+  PCF8574 *pcf;                      // beam inputs
+  DFRobotDFPlayerMini *player;       // audio
+  LaneOutputs out;                   // relay channel map
+  QueueHandle_t queue;               // RF events routed to this lane
 
-// Global variables for game state
-extern unsigned long gameTimeLimit;
-extern bool systemReady;
-extern TaskHandle_t mainTaskHandle;
+  volatile GameState state;
+  unsigned long gameTimeLimit;
+  bool systemReady;
+  volatile bool emergencyRestart;
+  volatile bool restarting;          // emergencyRestartLane() in progress
+  SemaphoreHandle_t ioMutex;         // held across this lane's Wire and DFPlayer calls
+  TaskHandle_t mainTaskHandle;
+  TaskHandle_t preparationTaskHandle;
+  TaskHandle_t questTaskHandle;
+  TaskHandle_t consequenceTaskHandle;
+
+  // Quest loop work time for the current turn (excludes the loop delay).
+  uint32_t loopCount;
+  uint32_t loopTotalUs;
+  uint32_t loopMaxUs;
+
+  // Changeover time between players for the current session.
+  uint32_t changeoverCount;
+  uint32_t changeoverTotalMs;
+  uint32_t changeoverMinMs;
+  uint32_t changeoverMaxMs;
+
+  BeamEngine beams;
+  TurnClock clock;
+};
+
+extern GameLane lanes[NUM_LANES];
 
 // shift register outputs assignments.
 enum srOutputs {
@@ -44,15 +178,16 @@ enum srOutputs {
   k4,
   LED_SETUP_OK, //not available on hardware.
   LED_I2C,
-  LED_DFPLAYER,       
-  LED_WIFI,            
+  LED_DFPLAYER,
+  LED_WIFI,
   LED_PREPARATION_READY,
-  LED_QUEST_0,         
-  LED_CONSEQUENCE_0,   
-  LED_RESTART_PROTOCOL 
+  LED_QUEST_0,
+  LED_CONSEQUENCE_0,
+  LED_RESTART_PROTOCOL
 };
 
-#define NUM_LASERS 8
+// Second lane relays mirror k1..k3 on the third 74HC595 stage.
+#define LANE2_SR_OFFSET 16
 
 struct AudioTrack {
     uint8_t trackNum;
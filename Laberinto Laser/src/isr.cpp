@@ -1,15 +1,14 @@
 #include "globals.h"
 #include "isr.h"
 
-void IRAM_ATTR rf_isr0() { handle_rf_isr(0); }
-void IRAM_ATTR rf_isr1() { handle_rf_isr(1); }
-void IRAM_ATTR rf_isr2() { handle_rf_isr(2); }
-void IRAM_ATTR rf_isr3() { handle_rf_isr(3); }
+// One handler for every RF input; the channel index comes in as the
+// interrupt argument (see gpio_declarations).
+void IRAM_ATTR rf_isr(void *arg) { handle_rf_isr((int)(intptr_t)arg); }
 
 void handle_rf_isr(int idx) {
   bool state = digitalRead(rfPins[idx]);
   unsigned long now = millis();
-  static BaseType_t xHigherPriorityTaskWoken;
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
   if (state && !pressed[idx]) {
     pressed[idx] = true;
     pressStart[idx] = now;
@@ -22,4 +21,4 @@ void handle_rf_isr(int idx) {
     xQueueSendFromISR(rfEventQueue, &event, &xHigherPriorityTaskWoken);
     if (xHigherPriorityTaskWoken) portYIELD_FROM_ISR();
   }
-}
\ No newline at end of file
+}
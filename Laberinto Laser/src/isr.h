@@ -1,14 +1,8 @@
 #pragma once
 
 #ifdef IRAM_ATTR
-void IRAM_ATTR rf_isr0();
-void IRAM_ATTR rf_isr1();
-void IRAM_ATTR rf_isr2();
-void IRAM_ATTR rf_isr3();
+void IRAM_ATTR rf_isr(void *arg);
 #else
-void rf_isr0();
-void rf_isr1();
-void rf_isr2();
-void rf_isr3();
+void rf_isr(void *arg);
 #endif
-void handle_rf_isr(int idx);
\ No newline at end of file
+void handle_rf_isr(int idx);
@@ -2,40 +2,125 @@
 #include "isr.h"
 #include "functions.h"
 #include "tasks.h"
+#include "beams.h"
+#include "gametimer.h"
+#include "taskmem.h"
+#include "supervisor.h"
+#include "sfx.h"
+#include "checkpoint.h"
+#include "bench.h"
 
 // --- Global variable definitions ---
-const int rfPins[4] = {23, 4, 15, 25};
+#if NUM_LANES > 1
+const int rfPins[NUM_RF_CHANNELS] = {23, 4, 15, 25,   // lane 1
+                                     32, 33, 34, 35}; // lane 2 (input-only pins)
+#else
+const int rfPins[NUM_RF_CHANNELS] = {23, 4, 15, 25};
+#endif
 const unsigned long LONG_PRESS_MS = 800;
 QueueHandle_t rfEventQueue;
-QueueHandle_t mainTaskQueue;
-ShiftRegister74HC595<2> sr(5, 19, 18);
+ShiftRegister74HC595<SR_CHIPS> sr(5, 19, 18);
+SemaphoreHandle_t srMutex;
 HardwareSerial myDFPlayerSerial(2);
 DFRobotDFPlayerMini myDFPlayer;
 PCF8574 pcf(0x20);
-volatile unsigned long pressStart[4] = {0, 0, 0, 0};
-volatile bool pressed[4] = {false, false, false, false};
+#if NUM_LANES > 1
+HardwareSerial myDFPlayerSerial2(1);
+DFRobotDFPlayerMini myDFPlayer2;
+PCF8574 pcf2(0x21);
+#endif
+volatile unsigned long pressStart[NUM_RF_CHANNELS] = {0};
+volatile bool pressed[NUM_RF_CHANNELS] = {false};
+volatile bool audioReady = false;
 
-// Global variables for game state
-unsigned long gameTimeLimit = 60000; // Default 1 minute
-bool systemReady = false;
-TaskHandle_t mainTaskHandle = NULL;
+// Per-lane game state and hardware routing
+GameLane lanes[NUM_LANES];
+
+static void initLane(GameLane *lane, uint8_t id, PCF8574 *lanePcf,
+                     DFRobotDFPlayerMini *player, uint8_t srOffset) {
+  lane->id = id;
+  lane->pcf = lanePcf;
+  lane->player = player;
+  lane->out.redLighting = k1 + srOffset;
+  lane->out.greenLighting = k2 + srOffset;
+  lane->out.lasers = k3 + srOffset;
+#if PER_BEAM_LASERS
+  lane->out.beamBase = SR_BEAM_BASE(id);
+#else
+  lane->out.beamBase = NO_OUTPUT;
+#endif
+  lane->queue = createLaneQueue(lane);
+  lane->ioMutex = createLaneIoMutex(lane);
+  lane->state = STATE_IDLE;
+  lane->gameTimeLimit = 60000; // Default 1 minute
+  lane->systemReady = false;
+  lane->emergencyRestart = false;
+  lane->restarting = false;
+  lane->mainTaskHandle = NULL;
+  lane->preparationTaskHandle = NULL;
+  lane->questTaskHandle = NULL;
+  lane->consequenceTaskHandle = NULL;
+  lane->loopCount = 0;
+  lane->loopTotalUs = 0;
+  lane->loopMaxUs = 0;
+  lane->changeoverCount = 0;
+  lane->changeoverTotalMs = 0;
+  lane->changeoverMinMs = 0;
+  lane->changeoverMaxMs = 0;
+  beamEngineInit(lane);
+  turnClockInit(lane);
+}
 
 void setup() {
   Serial.begin(115200);
   Serial.println("Setup started");
+  staticMemoryInit();
+  supervisorInit();
+  checkpointInit();
   sr.setAllLow();
 
-  gpio_declarations();
-
   Wire.begin(21, 22); // or your actual SDA, SCL pins
+  Wire.setTimeOut(20); // a stuck bus fails a read instead of stalling the loop
   if (!pcf.begin()) {
     Serial.println("PCF8574 not found!");
     while (1);
   } else {
     Serial.println("PCF8574 online.");
     // After successful I2C init
-    sr.set(LED_I2C, HIGH);
+    srSet(LED_I2C, HIGH);
+  }
+#if NUM_LANES > 1
+  if (!pcf2.begin()) {
+    Serial.println("Lane 2 PCF8574 (0x21) not found!");
+    while (1);
+  }
+  Serial.println("Lane 2 PCF8574 online.");
+#endif
+
+  initLane(&lanes[0], 0, &pcf, &myDFPlayer, 0);
+#if NUM_LANES > 1
+  initLane(&lanes[1], 1, &pcf2, &myDFPlayer2, LANE2_SR_OFFSET);
+#endif
+
+  sfxInit();
+
+  // Interrupts last: the ISR needs rfEventQueue
+  gpio_declarations();
+
+#ifndef BENCHMARK_BUILD
+  // Game tasks before the DFPlayers: each begin() waits for the module's
+  // reset, seconds in all, and the resume offer needs only the relays and
+  // the RF inputs. mainTask holds back anything audible until audioReady.
+  startSystemTask(SYS_TASK_LOG, loggerTask, "Logger", 1);
+  startSystemTask(SYS_TASK_RF, rfControllerTask, "RF Controller", 2);
+  startSystemTask(SYS_TASK_BEAMS, beamPatternTask, "Beam Patterns", 3);
+  startSystemTask(SYS_TASK_SUPERVISOR, supervisorTask, "Supervisor", 4);
+  // Alone on core 0 so the game tasks never delay a DMA refill
+  startSystemTask(SYS_TASK_SFX, sfxTask, "Sound FX", 5, 0);
+  for (int i = 0; i < NUM_LANES; i++) {
+    startLaneTask(&lanes[i], LANE_TASK_MAIN, mainTask, "Main Task", &lanes[i].mainTaskHandle);
   }
+#endif
 
   myDFPlayerSerial.begin(9600, SERIAL_8N1, 16, 17);
   // Serial.println("DFPlayer Mini test");
@@ -45,20 +130,30 @@ void setup() {
                      "check hardware connections.\n");
   } else {
       Serial.println("DFPlayer Mini online.");
-      sr.set(LED_DFPLAYER, HIGH);
+      srSet(LED_DFPLAYER, HIGH);
   }
+#if NUM_LANES > 1
+  myDFPlayerSerial2.begin(9600, SERIAL_8N1, 13, 14);
+  if (!myDFPlayer2.begin(myDFPlayerSerial2)) {
+      Serial.println("Unable to begin lane 2 DFPlayer Mini.");
+  } else {
+      Serial.println("Lane 2 DFPlayer Mini online.");
+  }
+#endif
 
-  rfEventQueue = xQueueCreate(1, sizeof(RfEvent));
-  mainTaskQueue = xQueueCreate(1, sizeof(MainTaskMsg));
-  
-  // Create RF controller task and main coordinator task
-  xTaskCreatePinnedToCore(rfControllerTask, "RF Controller", 2048, NULL, 2, NULL, 1);
-  xTaskCreatePinnedToCore(mainTask, "Main Task", 4096, NULL, 1, &mainTaskHandle, 1);
+  audioReady = true; // also without a DFPlayer: the game runs silent as before
 
-  sr.set(LED_SETUP_OK, HIGH);
-  Serial.println("Setup complete, main coordinator started.");
+#ifdef BENCHMARK_BUILD
+  // Benchmark firmware: same hardware setup, no game
+  benchStart();
+  return;
+#endif
+
+  srSet(LED_SETUP_OK, HIGH);
+  Serial.printf("Setup complete, %d lane coordinator(s) started.\n", NUM_LANES);
+  heapReport("boot");
 }
 
 void loop() {
   // test only
-}
\ No newline at end of file
+}
@@ -0,0 +1,68 @@
+#include "mixer.h"
+
+void mixerInit(Mixer *m) {
+  for (int i = 0; i < MIXER_VOICES; i++) {
+    m->voices[i].data = 0;
+    m->voices[i].length = 0;
+    m->voices[i].pos = 0;
+    m->voices[i].gain = 0;
+    m->voices[i].active = false;
+  }
+  m->masterGain = MIXER_UNITY_GAIN;
+}
+
+// Starts a sample on a free voice. When all voices are busy the one closest
+// to its end is stolen: the newest sound is the one that matters for
+// feedback. Returns the voice index.
+int mixerPlay(Mixer *m, const int16_t *data, uint32_t length, uint16_t gain) {
+  int voice = -1;
+  uint32_t leastLeft = 0xFFFFFFFF;
+  for (int i = 0; i < MIXER_VOICES; i++) {
+    MixerVoice *v = &m->voices[i];
+    if (!v->active) {
+      voice = i;
+      break;
+    }
+    uint32_t left = v->length - v->pos;
+    if (left < leastLeft) {
+      leastLeft = left;
+      voice = i;
+    }
+  }
+  MixerVoice *v = &m->voices[voice];
+  v->data = data;
+  v->length = length;
+  v->pos = 0;
+  v->gain = gain;
+  v->active = length > 0;
+  return voice;
+}
+
+void mixerStopAll(Mixer *m) {
+  for (int i = 0; i < MIXER_VOICES; i++) m->voices[i].active = false;
+}
+
+bool mixerIdle(const Mixer *m) {
+  for (int i = 0; i < MIXER_VOICES; i++) {
+    if (m->voices[i].active) return false;
+  }
+  return true;
+}
+
+// Sums every active voice into out (mono, 16-bit), saturating instead of
+// wrapping when several loud effects overlap.
+void mixerRender(Mixer *m, int16_t *out, uint32_t frames) {
+  for (uint32_t f = 0; f < frames; f++) {
+    int32_t acc = 0;
+    for (int i = 0; i < MIXER_VOICES; i++) {
+      MixerVoice *v = &m->voices[i];
+      if (!v->active) continue;
+      acc += ((int32_t)v->data[v->pos] * v->gain) >> 8;
+      if (++v->pos >= v->length) v->active = false;
+    }
+    acc = (acc * m->masterGain) >> 8;
+    if (acc > 32767) acc = 32767;
+    if (acc < -32768) acc = -32768;
+    out[f] = (int16_t)acc;
+  }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+
+// Small PCM mixer for the I2S sound effects. Plain C++ with no Arduino or
+// FreeRTOS dependency, so tools/sfx_render.cpp can run it on the host.
+// Not thread-safe: one task owns the mixer (sfxTask on target).
+
+#define MIXER_VOICES 4
+#define MIXER_UNITY_GAIN 256   // Q8 gain, 256 = 1.0
+
+struct MixerVoice {
+  const int16_t *data;
+  uint32_t length;
+  uint32_t pos;
+  uint16_t gain;
+  bool active;
+};
+
+struct Mixer {
+  MixerVoice voices[MIXER_VOICES];
+  uint16_t masterGain;
+};
+
+void mixerInit(Mixer *m);
+int mixerPlay(Mixer *m, const int16_t *data, uint32_t length, uint16_t gain);
+void mixerStopAll(Mixer *m);
+bool mixerIdle(const Mixer *m);
+void mixerRender(Mixer *m, int16_t *out, uint32_t frames);
@@ -0,0 +1,135 @@
+#include <driver/i2s.h>
+#include "globals.h"
+#include "functions.h"
+#include "taskmem.h"
+#include "mixer.h"
+#include "sfx_samples.h"
+#include "sfx.h"
+
+struct SfxSample {
+  const int16_t *data;
+  uint32_t length;
+  uint16_t gain;
+};
+
+static const SfxSample sfxTable[NUM_SFX] = {
+  {sfx_hit,     sizeof(sfx_hit) / sizeof(sfx_hit[0]),         MIXER_UNITY_GAIN},
+  {sfx_tick,    sizeof(sfx_tick) / sizeof(sfx_tick[0]),       MIXER_UNITY_GAIN * 3 / 4},
+  {sfx_warning, sizeof(sfx_warning) / sizeof(sfx_warning[0]), MIXER_UNITY_GAIN},
+};
+
+static Mixer mixer;
+static bool sfxReady = false;
+// Request to first sample queued for DMA, worst case since the last report.
+static volatile uint32_t maxPickupUs = 0;
+
+// Queues one mixed block. The DAC takes unsigned 8-bit samples, so silence
+// is mid-scale (0x80), not zero.
+static void writeBlock(const int16_t *block) {
+  size_t written;
+#if SFX_OUTPUT == SFX_OUTPUT_DAC
+  static uint16_t frames[SFX_BLOCK_FRAMES * 2]; // right/left slots, 8-bit in the high byte
+  for (int i = 0; i < SFX_BLOCK_FRAMES; i++) {
+    uint16_t level = (uint16_t)(block[i] + 32768) & 0xFF00;
+    // The I2S DMA swaps 16-bit halves: the second slot is the left
+    // channel (DAC2). The right slot stays zero, its DAC is off.
+    frames[2 * i] = 0;
+    frames[2 * i + 1] = level;
+  }
+  i2s_write(I2S_NUM_0, frames, sizeof(frames), &written, portMAX_DELAY);
+#else
+  i2s_write(I2S_NUM_0, block, SFX_BLOCK_FRAMES * sizeof(int16_t), &written, portMAX_DELAY);
+#endif
+}
+
+void sfxInit(void) {
+  mixerInit(&mixer);
+#if SFX_OUTPUT != SFX_OUTPUT_NONE
+  i2s_config_t cfg = {};
+#if SFX_OUTPUT == SFX_OUTPUT_DAC
+  cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+  cfg.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+  cfg.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+#else
+  cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
+  cfg.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+  cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+#endif
+  cfg.sample_rate = SFX_SAMPLE_RATE;
+  cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  cfg.dma_buf_count = SFX_DMA_BUFFERS;
+  cfg.dma_buf_len = SFX_BLOCK_FRAMES;
+  cfg.use_apll = false;
+#if SFX_OUTPUT == SFX_OUTPUT_DAC
+  // Auto-clear would fill an underrun with zeros, the DAC's lowest level:
+  // a pop. Without it the DMA replays the last blocks, which are mid-scale
+  // silence unless an effect is playing.
+  cfg.tx_desc_auto_clear = false;
+#else
+  cfg.tx_desc_auto_clear = true; // zero is silence for signed I2S samples
+#endif
+
+  // DMA buffers are allocated here, once at boot
+  if (i2s_driver_install(I2S_NUM_0, &cfg, 0, NULL) != ESP_OK) {
+    Serial.println("I2S sound effects unavailable.");
+    return;
+  }
+#if SFX_OUTPUT == SFX_OUTPUT_DAC
+  // DAC2 (GPIO26) only. i2s_set_pin(NULL) would enable DAC1 as well, and
+  // DAC1 is GPIO25, the RF4 input.
+  i2s_set_dac_mode(I2S_DAC_CHANNEL_LEFT_EN);
+  // The DMA buffers start zeroed; move the DAC to mid-scale before the
+  // first effect, so it doesn't pop then
+  static const int16_t silence[SFX_BLOCK_FRAMES] = {0};
+  for (int i = 0; i < SFX_DMA_BUFFERS; i++) writeBlock(silence);
+#else
+  i2s_pin_config_t pins = {};
+  pins.bck_io_num = 26;
+  pins.ws_io_num = 27;
+  pins.data_out_num = 13;
+  pins.data_in_num = I2S_PIN_NO_CHANGE;
+  i2s_set_pin(I2S_NUM_0, &pins);
+#endif
+  sfxReady = true;
+  Serial.println("I2S sound effects online.");
+#endif
+}
+
+// Renders one block at a time. i2s_write() blocks until a DMA buffer is
+// free, which paces the loop; requests are picked up between blocks, so a
+// new effect is audible after at most SFX_DMA_BUFFERS + 1 blocks.
+void sfxTask(void *pvParameters) {
+  static int16_t block[SFX_BLOCK_FRAMES];
+  SfxRequest req;
+
+  while (1) {
+    if (!sfxReady) {
+      // No output: drop requests so callers never notice
+      xQueueReceive(sfxQueue, &req, portMAX_DELAY);
+      continue;
+    }
+    while (xQueueReceive(sfxQueue, &req, 0) == pdTRUE) {
+      const SfxSample *s = &sfxTable[req.id];
+      mixerPlay(&mixer, s->data, s->length, s->gain);
+      uint32_t pickupUs = micros() - req.requestUs;
+      if (pickupUs > maxPickupUs) maxPickupUs = pickupUs;
+    }
+    mixerRender(&mixer, block, SFX_BLOCK_FRAMES);
+    writeBlock(block);
+  }
+}
+
+// Never blocks: a full request queue drops the effect.
+void sfxPlay(GameLane *lane, SfxId id) {
+  if (lane->id != SFX_LANE) return;
+  SfxRequest req = {(uint8_t)id, (uint32_t)micros()};
+  xQueueSend(sfxQueue, &req, 0);
+}
+
+void sfxReportLatency(GameLane *lane) {
+  if (lane->id != SFX_LANE || !sfxReady) return;
+  uint32_t blockUs = 1000000UL * SFX_BLOCK_FRAMES / SFX_SAMPLE_RATE;
+  laneLog(lane, "SFX start latency: pickup max %lu us + up to %lu us queued in DMA",
+          (unsigned long)maxPickupUs, (unsigned long)(SFX_DMA_BUFFERS * blockUs));
+  maxPickupUs = 0;
+}
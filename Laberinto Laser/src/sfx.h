@@ -0,0 +1,37 @@
+#pragma once
+#include "globals.h"
+
+// Low-latency sound effects on the I2S peripheral, mixed over whatever the
+// DFPlayer is playing. Output is selected with SFX_OUTPUT:
+//   SFX_OUTPUT_NONE      no I2S output
+//   SFX_OUTPUT_DAC       internal DAC on GPIO26 (default)
+//   SFX_OUTPUT_EXTERNAL  external I2S amp: BCK 26, WS 27, DATA 13
+#define SFX_OUTPUT_NONE     0
+#define SFX_OUTPUT_DAC      1
+#define SFX_OUTPUT_EXTERNAL 2
+#ifndef SFX_OUTPUT
+#define SFX_OUTPUT SFX_OUTPUT_DAC
+#endif
+// GPIO13 is the lane 2 DFPlayer RX
+static_assert(SFX_OUTPUT != SFX_OUTPUT_EXTERNAL || NUM_LANES == 1,
+              "external I2S amp needs GPIO13, used by lane 2");
+
+// There is one I2S output; its speaker belongs to this lane.
+#define SFX_LANE 0
+
+// Frames per block and DMA buffer. Worst-case start latency is
+// (SFX_DMA_BUFFERS + 1) blocks: 3 x 2 ms at 16 kHz.
+#define SFX_BLOCK_FRAMES 32
+#define SFX_DMA_BUFFERS  2
+
+enum SfxId { SFX_HIT, SFX_TICK, SFX_WARNING, NUM_SFX };
+
+struct SfxRequest {
+  uint8_t id;
+  uint32_t requestUs;
+};
+
+void sfxInit(void);
+void sfxTask(void *pvParameters);
+void sfxPlay(GameLane *lane, SfxId id);
+void sfxReportLatency(GameLane *lane);
@@ -0,0 +1,609 @@
+#pragma once
+// Generated by tools/gen_sfx.py - do not edit.
+#include <stdint.h>
+
+#define SFX_SAMPLE_RATE 16000
+
+static const int16_t sfx_hit[2240] = {
+    26214, 26208, 26202, 26196, 25178, -10045, -26178, -26173, -26167, -26161, -15968, 19372,
+    26143, 26137, 26132, 26126, 6906, -26114, -26108, -26102, -26096, -26090, 1795, 26079,
+    26073, 26067, 26061, 24787, -9974, -26043, -26037, -26032, -26026, -17362, 17519, 26008,
+    26002, 25996, 25990, 10173, -24359, -25973, -25967, -25961, -25955, -3345, 25943, 25937,
+    25931, 25925, 25919, -3032, -25908, -25902, -25896, -25890, -25217, 8898, 25872, 25866,
+    25860, 25854, 20033, -14217, -25836, -25830, -25825, -25819, -15173, 18974, 25801, 25795,
+    25789, 25783, 10697, -23171, -25765, -25759, -25753, -25747, -6644, 25735, 25729, 25723,
+    25717, 25711, 3042, -25699, -25694, -25688, -25682, -25676, 93, 25664, 25658, 25652,
+    25646, 25640, -2756, -25628, -25622, -25616, -25610, -25604, 4943, 25592, 25586, 25580,
+    25574, 25568, -6657, -25556, -25550, -25544, -25538, -24989, 7902, 25520, 25514, 25508,
+    25502, 24146, -8682, -25484, -25478, -25472, -25466, -23729, 9001, 25448, 25442, 25436,
+    25430, 23742, -8863, -25411, -25405, -25399, -25393, -24180, 8269, 25375, 25369, 25363,
+    25357, 25039, -7220, -25339, -25333, -25327, -25321, -25315, 5714, 25303, 25296, 25290,
+    25284, 25278, -3751, -25266, -25260, -25254, -25248, -25242, 1333, 25230, 25224, 25218,
+    25211, 25205, 1538, -25193, -25187, -25181, -25175, -25169, -4852, 25157, 25151, 25144,
+    25138, 25132, 8595, -23038, -25114, -25108, -25102, -25096, -12742, 18957, 25077, 25071,
+    25065, 25059, 17257, -14356, -25041, -25034, -25028, -25022, -22088, 9238, 25004, 24998,
+    24991, 24985, 24979, -3619, -24967, -24961, -24955, -24948, -24942, -2465, 24930, 24924,
+    24918, 24912, 24905, 8956, -21984, -24887, -24881, -24875, -24868, -15765, 15240, 24850,
+    24844, 24838, 24831, 22776, -7874, -24813, -24807, -24800, -24794, -24788, -34, 24776,
+    24770, 24763, 24757, 24751, 8363, -22063, -24732, -24726, -24720, -24714, -16946, 13552,
+    24695, 24689, 24683, 24676, 24670, -4342, -24658, -24652, -24645, -24639, -24633, -5383,
+    24479, 24614, 24608, 24602, 24596, 15378, -14758, -24577, -24571, -24564, -24558, -24552,
+    4215, 24539, 24533, 24527, 24521, 24514, 6865, -22746, -24496, -24489, -24483, -24477,
+    -18111, 11608, 24458, 24452, 24445, 24439, 24433, 353, -24420, -24414, -24408, -24401,
+    -24395, -12698, 16793, 24376, 24370, 24364, 24357, 24351, -4053, -24338, -24332, -24326,
+    -24320, -24313, -9267, 19869, 24294, 24288, 24282, 24275, 22509, -6356, -24256, -24250,
+    -24244, -24237, -24231, -7879, 20942, 24212, 24206, 24199, 24193, 22045, -6592, -24174,
+    -24168, -24161, -24155, -24149, -8537, 20072, 24130, 24123, 24117, 24111, 23486, -4783,
+    -24091, -24085, -24079, -24072, -24066, -11208, 17251, 24047, 24040, 24034, 24028, 24021,
+    -937, -24009, -24002, -23996, -23989, -23983, -15816, 12419, 23964, 23957, 23951, 23945,
+    23938, 4921, -22853, -23919, -23913, -23906, -23900, -22195, 5515, 23880, 23874, 23868,
+    23861, 23855, 12682, -15174, -23835, -23829, -23823, -23816, -23810, -3442, 23797, 23790,
+    23784, 23777, 23771, 22060, -5262, -23752, -23745, -23739, -23732, -23726, -14228, 13250,
+    23706, 23700, 23693, 23687, 23680, 6736, -20414, -23661, -23655, -23648, -23642, -23635,
+    254, 23622, 23616, 23609, 23603, 23596, 20273, -6635, -23577, -23570, -23564, -23557,
+    -23551, -14613, 12346, 23531, 23525, 23518, 23511, 23505, 9403, -17362, -23485, -23479,
+    -23472, -23466, -23459, -4715, 21685, 23440, 23433, 23427, 23420, 23413, 592, -23400,
+    -23394, -23387, -23381, -23374, -23097, 2941, 23354, 23348, 23341, 23335, 23328, 20235,
+    -5877, -23308, -23302, -23295, -23289, -23282, -17877, 8218, 23262, 23256, 23249, 23242,
+    23236, 16049, -9971, -23216, -23209, -23203, -23196, -23190, -14765, 11147, 23170, 23163,
+    23157, 23150, 23143, 14035, -11754, -23123, -23117, -23110, -23103, -23097, -13859, 11800,
+    23077, 23070, 23064, 23057, 23050, 14235, -11288, -23030, -23024, -23017, -23010, -23004,
+    -15158, 10219, 22984, 22977, 22970, 22964, 22957, 16616, -8590, -22937, -22930, -22924,
+    -22917, -22910, -18591, 6400, 22890, 22883, 22877, 22870, 22863, 21059, -3646, -22843,
+    -22836, -22830, -22823, -22816, -22809, 332, 22796, 22789, 22783, 22776, 22769, 22762,
+    3530, -20894, -22742, -22735, -22729, -22722, -22715, -7916, 16608, 22695, 22688, 22681,
+    22675, 22668, 12782, -11689, -22648, -22641, -22634, -22627, -22620, -18059, 6143, 22600,
+    22593, 22586, 22580, 22573, 22566, -3, -22553, -22546, -22539, -22532, -22525, -22518,
+    -6663, 17290, 22498, 22491, 22484, 22478, 22471, 13746, -10181, -22450, -22443, -22437,
+    -22430, -22423, -21086, 2377, 22402, 22396, 22389, 22382, 22375, 22368, 5989, -17541,
+    -22348, -22341, -22334, -22327, -22320, -14717, 8785, 22299, 22293, 22286, 22279, 22272,
+    22265, 710, -22216, -22244, -22237, -22231, -22224, -22217, -10681, 12578, 22196, 22189,
+    22182, 22175, 22168, 20771, -2019, -22148, -22141, -22134, -22127, -22120, -22113, -9106,
+    13861, 22092, 22085, 22078, 22071, 22064, 20321, -2222, -22043, -22037, -22030, -22023,
+    -22016, -22009, -10001, 12711, 21988, 21981, 21974, 21967, 21960, 21953, 65, -21939,
+    -21932, -21925, -21918, -21911, -21904, -13305, 9127, 21883, 21876, 21869, 21862, 21855,
+    21848, 4802, -17348, -21827, -21820, -21813, -21806, -21799, -18862, 3076, 21777, 21770,
+    21763, 21756, 21749, 21742, 11873, -10161, -21721, -21714, -21707, -21700, -21693, -21686,
+    -5406, 16369, 21664, 21657, 21650, 21643, 21636, 20951, -408, -21615, -21608, -21601,
+    -21594, -21586, -21579, -16025, 5496, 21558, 21551, 21544, 21537, 21530, 21522, 11655,
+    -9826, -21501, -21494, -21487, -21480, -21472, -21465, -7913, 13399, 21444, 21437, 21430,
+    21422, 21415, 21408, 4840, -16234, -21387, -21379, -21372, -21365, -21358, -21351, -2455,
+    18358, 21329, 21322, 21315, 21308, 21300, 21234, 764, -19801, -21272, -21264, -21257,
+    -21250, -21243, -20181, 234, 20588, 21214, 21207, 21199, 21192, 21185, 19759, -543,
+    -20739, -21156, -21149, -21141, -21134, -21127, -19971, 169, 20261, 21098, 21090, 21083,
+    21076, 21069, 20807, 881, -19152, -21040, -21032, -21025, -21018, -21010, -21003, -2602,
+    17404, 20981, 20974, 20966, 20959, 20952, 20945, 4983, -14998, -20923, -20915, -20908,
+    -20901, -20893, -20886, -8007, 11918, 20864, 20856, 20849, 20842, 20834, 20827, 11642,
+    -8149, -20805, -20798, -20790, -20783, -20775, -20768, -15835, 3691, 20746, 20738, 20731,
+    20724, 20716, 20709, 20506, 1437, -17813, -20679, -20672, -20664, -20657, -20650, -20642,
+    -7182, 12164, 20620, 20612, 20605, 20597, 20590, 20583, 13445, -5733, -20560, -20553,
+    -20545, -20538, -20530, -20523, -20074, -1413, 17420, 20493, 20485, 20478, 20470, 20463,
+    20455, 9141, -9801, -20433, -20425, -20418, -20410, -20403, -20395, -17232, 1338, 19704,
+    20365, 20358, 20350, 20343, 20335, 20328, 7760, -10883, -20305, -20297, -20290, -20282,
+    -20275, -20267, -17171, 1106, 19212, 20237, 20229, 20222, 20214, 20207, 20199, 9295,
+    -9069, -20176, -20169, -20161, -20153, -20146, -20138, -19836, -2054, 15974, 20108, 20100,
+    20092, 20085, 20077, 20069, 13634, -4365, -20046, -20039, -20031, -20024, -20016, -20008,
+    -20001, -8052, 9871, 19978, 19970, 19962, 19954, 19947, 19939, 19931, 3217, -14439,
+    -19908, -19901, -19893, -19885, -19877, -19870, -16607, 805, 18093, 19839, 19831, 19823,
+    19816, 19808, 19800, 13422, -3989, -19777, -19769, -19761, -19754, -19746, -19738, -19730,
+    -10986, 6336, 19707, 19699, 19691, 19684, 19676, 19668, 19660, 9328, -7862, -19637,
+    -19629, -19621, -19613, -19606, -19598, -19590, -8460, 8582, 19566, 19559, 19551, 19543,
+    19535, 19527, 19519, 8381, -8513, -19496, -19488, -19480, -19472, -19464, -19456, -19448,
+    -9084, 7661, 19425, 19417, 19409, 19401, 19393, 19385, 19377, 10551, -6029, -19354,
+    -19346, -19338, -19330, -19322, -19314, -19306, -12759, 3618, 19282, 19274, 19266, 19258,
+    19250, 19242, 19234, 15664, -430, -16453, -19202, -19194, -19186, -19178, -19170, -19162,
+    -19154, -3515, 12550, 19130, 19122, 19114, 19106, 19098, 19090, 19082, 8175, -7819,
+    -19058, -19050, -19042, -19034, -19026, -19018, -19010, -13466, 2272, 17734, 18977, 18969,
+    18961, 18953, 18945, 18937, 18929, 4035, -11599, -18905, -18896, -18888, -18880, -18872,
+    -18864, -18856, -10971, 4535, 18831, 18823, 18815, 18807, 18799, 18791, 18782, 18317,
+    3342, -11971, -18750, -18742, -18733, -18725, -18717, -18709, -18701, -11804, 3371, 18166,
+    18668, 18660, 18651, 18643, 18635, 18627, 18618, 6030, -9039, -18594, -18585, -18577,
+    -18569, -18561, -18552, -18544, -15825, -1146, 13630, 18511, 18503, 18494, 18486, 18478,
+    18469, 18461, 11924, -2780, -17176, -18428, -18420, -18411, -18403, -18395, -18386, -18378,
+    -8876, 5734, 18353, 18345, 18336, 18328, 18319, 18311, 18303, 18294, 6730, -7730,
+    -18269, -18261, -18252, -18244, -18235, -18227, -18219, -18210, -5499, 8794, 18185, 18177,
+    18168, 18160, 18151, 18143, 18134, 18126, 5184, -8950, -18100, -18092, -18083, -18075,
+    -18066, -18058, -18049, -18041, -5773, 8212, 18015, 18007, 17998, 17990, 17981, 17973,
+    17964, 17956, 7250, -6585, -17930, -17922, -17913, -17904, -17896, -17887, -17879, -17870,
+    -9585, 4070, 17321, 17836, 17827, 17819, 17810, 17801, 17793, 17784, 12730, -670,
+    -13987, -17750, -17741, -17732, -17724, -17715, -17706, -17698, -16604, -3589, 9733, 17663,
+    17654, 17646, 17637, 17628, 17619, 17611, 17602, 8644, -4545, -17304, -17567, -17558,
+    -17550, -17541, -17532, -17523, -17515, -14369, -1537, 11410, 17480, 17471, 17462, 17453,
+    17444, 17436, 17427, 17418, 8391, -4479, -16936, -17383, -17374, -17365, -17356, -17348,
+    -17339, -17330, -15782, -3368, 9315, 17294, 17286, 17277, 17268, 17259, 17250, 17241,
+    17232, 11863, -594, -12980, -17197, -17188, -17179, -17170, -17161, -17152, -17143, -17134,
+    -8907, 3468, 15531, 17098, 17089, 17080, 17071, 17062, 17053, 17044, 17035, 6968,
+    -5264, -17008, -16999, -16990, -16981, -16972, -16963, -16954, -16945, -16936, -6060, 6010,
+    16909, 16900, 16891, 16881, 16872, 16863, 16854, 16845, 16836, 6176, -5730, -16809,
+    -16800, -16790, -16781, -16772, -16763, -16754, -16745, -16735, -7296, 4441, 15807, 16699,
+    16690, 16680, 16671, 16662, 16653, 16644, 16634, 9387, -2151, -13501, -16597, -16588,
+    -16579, -16570, -16560, -16551, -16542, -16533, -12391, -1125, 10207, 16495, 16486, 16477,
+    16468, 16458, 16449, 16440, 16430, 16208, 5347, -5897, -16393, -16384, -16374, -16365,
+    -16355, -16346, -16337, -16327, -16318, -10423, 580, 11521, 16280, 16271, 16261, 16252,
+    16242, 16233, 16224, 16214, 16176, 5658, -5251, -15759, -16167, -16157, -16148, -16138,
+    -16129, -16119, -16110, -16100, -12618, -2046, 8651, 16062, 16052, 16043, 16033, 16024,
+    16014, 16005, 15995, 15985, 10128, -373, -10827, -15947, -15937, -15928, -15918, -15909,
+    -15899, -15889, -15880, -15870, -8759, 1607, 11841, 15831, 15822, 15812, 15802, 15792,
+    15783, 15773, 15763, 15753, 8517, -1681, -11746, -15715, -15705, -15695, -15685, -15675,
+    -15666, -15656, -15646, -15636, -9383, 621, 10563, 15597, 15587, 15577, 15567, 15558,
+    15548, 15538, 15528, 15518, 11309, 1548, -8294, -15478, -15469, -15459, -15449, -15439,
+    -15429, -15419, -15409, -15399, -14216, -4788, 4926, 14305, 15349, 15339, 15329, 15319,
+    15309, 15299, 15289, 15279, 15269, 9023, -465, -9904, -15229, -15219, -15209, -15198,
+    -15188, -15178, -15168, -15158, -15148, -14099, -5022, 4343, 13423, 15097, 15087, 15077,
+    15067, 15057, 15046, 15036, 15026, 15016, 11359, 2310, -6858, -14975, -14965, -14954,
+    -14944, -14934, -14924, -14913, -14903, -14893, -14882, -9828, -899, 8064, 14841, 14831,
+    14820, 14810, 14800, 14789, 14779, 14769, 14758, 14748, 9526, 766, -8019, -14706,
+    -14696, -14685, -14675, -14664, -14654, -14643, -14633, -14622, -14612, -10423, -1877, 6756,
+    14570, 14559, 14549, 14538, 14528, 14517, 14507, 14496, 14485, 14475, 12457, 4190,
+    -4288, -12511, -14422, -14411, -14400, -14390, -14379, -14368, -14358, -14347, -14336, -14326,
+    -7637, 629, 8842, 14283, 14272, 14261, 14251, 14240, 14229, 14218, 14207, 14197,
+    14186, 12083, 4166, -3951, -11842, -14132, -14121, -14110, -14099, -14088, -14077, -14066,
+    -14055, -14045, -14034, -9941, -2111, 5808, 13410, 13979, 13968, 13957, 13946, 13935,
+    13924, 13913, 13902, 13891, 13880, 9134, 1462, -6265, -13659, -13824, -13813, -13802,
+    -13791, -13780, -13769, -13758, -13747, -13735, -13724, -9645, -2178, 5376, 12650, 13668,
+    13657, 13646, 13634, 13623, 13612, 13601, 13589, 13578, 13567, 11406, 4206, -3175,
+    -10387, -13510, -13499, -13487, -13476, -13465, -13453, -13442, -13430, -13419, -13408, -13396,
+    -7465, -310, 6840, 13350, 13339, 13327, 13316, 13304, 13293, 13281, 13270, 13258,
+    13246, 13235, 11799, 5003, -1999, -8893, -13177, -13165, -13154, -13142, -13130, -13118,
+    -13107, -13095, -13083, -13072, -13060, -10705, -4047, 2770, 9447, 13001, 12989, 12977,
+    12966, 12954, 12942, 12930, 12918, 12906, 12894, 12883, 11007, 4559, -2065, -8583,
+    -12823, -12811, -12799, -12787, -12775, -12763, -12751, -12739, -12727, -12715, -12703, -12625,
+    -6466, -58, 6334, 12447, 12630, 12618, 12606, 12594, 12581, 12569, 12557, 12545,
+    12532, 12520, 12508, 9648, 3531, -2710, -8823, -12447, -12434, -12422, -12410, -12397,
+    -12385, -12372, -12360, -12348, -12335, -12323, -12310, -8209, -2237, 3803, 9677, 12248,
+    12235, 12223, 12210, 12198, 12185, 12172, 12160, 12147, 12135, 12122, 12109, 8305,
+    2537, -3309, -9013, -12046, -12033, -12020, -12007, -11995, -11982, -11969, -11956, -11943,
+    -11931, -11918, -11905, -9851, -4345, 1302, 6883, 11840, 11827, 11814, 11801, 11788,
+    11775, 11762, 11749, 11736, 11723, 11710, 11697, 11684, 7534, 2146, -3299, -8611,
+    -11618, -11605, -11592, -11578, -11565, -11552, -11538, -11525, -11512, -11499, -11485, -11472,
+    -11458, -6882, -1681, 3559, 8661, 11391, 11378, 11364, 11351, 11337, 11324, 11310,
+    11297, 11283, 11269, 11256, 11242, 11229, 7827, 2859, -2184, -7138, -11160, -11146,
+    -11133, -11119, -11105, -11091, -11077, -11063, -11050, -11036, -11022, -11008, -10994, -10211,
+    -5553, -738, 4082, 8758, 10910, 10896, 10882, 10868, 10853, 10839, 10825, 10811,
+    10797, 10783, 10768, 10754, 10740, 9544, 5066, 453, -4155, -8622, -10654, -10639,
+    -10625, -10610, -10596, -10582, -10567, -10553, -10538, -10523, -10509, -10494, -10480, -10465,
+    -6261, -1884, 2530, 6854, 10391, 10377, 10362, 10347, 10332, 10317, 10302, 10288,
+    10273, 10258, 10243, 10228, 10213, 10198, 8945, 4873, 685, -3504, -7580, -10107,
+    -10092, -10077, -10061, -10046, -10031, -10016, -10000, -9985, -9970, -9954, -9939, -9923,
+    -9908, -9147, -5306, -1343, 2638, 6533, 9814, 9799, 9783, 9767, 9752, 9736,
+    9720, 9704, 9689, 9673, 9657, 9641, 9625, 9609, 9593, 7373, 3685, -78,
+    -3822, -7453, -9497, -9481, -9464, -9448, -9432, -9416, -9399, -9383, -9367, -9350,
+    -9334, -9317, -9301, -9284, -9268, -7448, -3989, -452, 3078, 6518, 9168, 9151,
+    9135, 9118, 9101, 9084, 9067, 9050, 9033, 9016, 8999, 8982, 8965, 8948,
+    8931, 8914, 5999, 2727, -590, -3877, -7059, -8810, -8792, -8775, -8757, -8740,
+    -8722, -8705, -8687, -8669, -8652, -8634, -8616, -8598, -8580, -8563, -8545, -6448,
+    -3421, -340, 2732, 5729, 8436, 8418, 8400, 8381, 8363, 8345, 8326, 8308,
+    8289, 8271, 8252, 8234, 8215, 8196, 8178, 8159, 8140, 5784, 2978, 130,
+    -2703, -5466, -8026, -8007, -7988, -7969, -7949, -7930, -7911, -7891, -7872, -7852,
+    -7833, -7813, -7794, -7774, -7754, -7734, -7714, -6921, -4395, -1805, 802, 3376,
+    5871, 7574, 7554, 7533, 7513, 7493, 7472, 7451, 7431, 7410, 7389, 7369,
+    7348, 7327, 7306, 7285, 7264, 7243, 7221, 4975, 2646, 289, -2056, -4347,
+    -6547, -7071, -7050, -7028, -7006, -6984, -6962, -6940, -6918, -6896, -6873, -6851,
+    -6828, -6806, -6783, -6761, -6738, -6715, -6692, -5058, -2991, -893, 1200, 3257,
+    5244, 6530, 6506, 6483, 6459, 6435, 6411, 6387, 6363, 6339, 6315, 6291,
+    6266, 6242, 6217, 6192, 6168, 6143, 6118, 6092, 4917, 3118, 1292, -536,
+    -2337, -4085, -5755, -5888, -5862, -5835, -5809, -5783, -5756, -5729, -5702, -5675,
+    -5648, -5621, -5594, -5566, -5539, -5511, -5483, -5455, -5427, -5398, -4741, -3226,
+    -1686, -142, 1384, 2872, 4303, 5166, 5136, 5106, 5076, 5046, 5015, 4985,
+    4954, 4923, 4892, 4860, 4828, 4797, 4765, 4732, 4700, 4667, 4634, 4601,
+    4567, 4534, 3376, 2147, 912, -312, -1512, -2671, -3777, -4254, -4218, -4182,
+    -4145, -4108, -4070, -4032, -3994, -3955, -3916, -3877, -3837, -3797, -3756, -3715,
+    -3674, -3632, -3589, -3546, -3503, -3459, -3377, -2498, -1616, -740, 117, 947,
+    1740, 2487, 3034, 2983, 2931, 2878, 2824, 2769, 2713, 2656, 2598, 2538,
+    2477, 2414, 2350, 2284, 2215, 2145, 2072, 1997, 1919, 1837, 1751, 1662,
+    1567, 1316, 898, 521, 194, -69, -249, -310,
+};
+
+static const int16_t sfx_tick[400] = {
+    0, 12610, 18939, 16146, 5779, -7068, -16252, -17515, -10456, 1378, 12268, 17082,
+    13690, 3901, -7493, -15058, -15309, -8306, 2456, 11789, 15311, 11498, 2336, -7706,
+    -13852, -13289, -6449, 3275, 11208, 13640, 9555, 1047, -7746, -12655, -11452, -4858,
+    3874, 10556, 12076, 7842, 0, -7648, -11487, -9793, -3505, 4287, 9857, 10624,
+    6342, -836, -7441, -10361, -8303, -2366, 4544, 9133, 9285, 5038, -1490, -7151,
+    -9287, -6974, -1417, 4674, 8402, 8060, 3911, -1986, -6798, -8273, -5795, -635,
+    4698, 7676, 6946, 2946, -2350, -6402, -7324, -4756, 0, 4639, 6967, 5940,
+    2126, -2600, -5979, -6444, -3847, 507, 4513, 6284, 5036, 1435, -2756, -5540,
+    -5632, -3056, 903, 4337, 5633, 4230, 859, -2835, -5096, -4889, -2372, 1205,
+    4123, 5018, 3515, 385, -2850, -4656, -4213, -1787, 1425, 3883, 4442, 2885,
+    0, -2814, -4226, -3603, -1289, 1577, 3626, 3908, 2333, -308, -2737, -3811,
+    -3055, -870, 1672, 3360, 3416, 1853, -548, -2631, -3416, -2566, -521, 1719,
+    3091, 2965, 1439, -731, -2501, -3044, -2132, -234, 1728, 2824, 2555, 1084,
+    -864, -2355, -2694, -1750, 0, 1707, 2563, 2185, 782, -957, -2199, -2370,
+    -1415, 187, 1660, 2312, 1853, 528, -1014, -2038, -2072, -1124, 332, 1596,
+    2072, 1556, 316, -1043, -1875, -1798, -873, 443, 1517, 1846, 1293, 142,
+    -1048, -1713, -1550, -657, 524, 1429, 1634, 1061, 0, -1035, -1555, -1325,
+    -474, 580, 1334, 1438, 858, -113, -1007, -1402, -1124, -320, 615, 1236,
+    1257, 682, -202, -968, -1257, -944, -192, 633, 1137, 1091, 529, -269,
+    -920, -1120, -784, -86, 636, 1039, 940, 399, -318, -866, -991, -644,
+    0, 628, 943, 804, 288, -352, -809, -872, -521, 69, 611, 850,
+    682, 194, -373, -750, -762, -414, 122, 587, 762, 572, 116, -384,
+    -690, -662, -321, 163, 558, 679, 476, 52, -386, -630, -570, -242,
+    193, 526, 601, 390, 0, -381, -572, -488, -175, 213, 491, 529,
+    316, -42, -370, -516, -413, -118, 226, 455, 462, 251, -74, -356,
+    -462, -347, -71, 233, 418, 401, 195, -99, -338, -412, -289, -32,
+    234, 382, 346, 147, -117, -319, -365, -237, 0, 231, 347, 296,
+    106, -129, -298, -321, -192, 25, 225, 313, 251, 71, -137, -276,
+    -280, -152, 45, 216, 280, 211, 43, -141, -254, -243, -118, 60,
+    205, 250, 175, 19, -142, -232, -210, -89, 71, 193, 221, 144,
+    0, -140, -210, -179, -64, 79, 181, 195, 116, -15, -136, -190,
+    -152, -43, 83, 167, 170, 92, -27, -131, -170, -128, -26, 86,
+    154, 148, 72, -36, -125, -152, -106, -12, 86, 141, 127, 54,
+    -43, -117, -134, -87,
+};
+
+static const int16_t sfx_warning[4480] = {
+    0, 162, 609, 1234, 1878, 2360, 2512, 2212, 1407, 135, -1477, -3222,
+    -4842, -6062, -6637, -6387, -5234, -3226, -540, 2533, 5617, 8300, 10182, 10942,
+    10377, 8447, 5290, 1214, -3327, -7789, -11598, -14225, -15261, -14472, -11844, -7593,
+    -2156, 3857, 9730, 14726, 18179, 19582, 18660, 15413, 10129, 3364, -4119, -11433,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399,
+    -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026,
+    22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205,
+    -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588,
+    -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050,
+    22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971,
+    -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385, 19366, 14058, 7088, -720,
+    -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743,
+    22531, 22655, 20100, 15168, 8444, 720, -7088, -14058, -19366, -22385, -22756, -20437,
+    -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159,
+    -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124,
+    21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437,
+    15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159,
+    5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124,
+    -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581,
+    17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004,
+    2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219,
+    -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385,
+    19366, 14058, 7088, -720, -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770,
+    0, 7770, 14621, 19743, 22531, 22655, 20100, 15168, 8444, 720, -7088, -14058,
+    -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835,
+    20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413,
+    -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399,
+    -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026,
+    22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205,
+    -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588,
+    -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050,
+    22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971,
+    -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385, 19366, 14058, 7088, -720,
+    -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743,
+    22531, 22655, 20100, 15168, 8444, 720, -7088, -14058, -19366, -22385, -22756, -20437,
+    -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159,
+    -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124,
+    21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437,
+    15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159,
+    5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124,
+    -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581,
+    17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004,
+    2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219,
+    -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385,
+    19366, 14058, 7088, -720, -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770,
+    0, 7770, 14621, 19743, 22531, 22655, 20100, 15168, 8444, 720, -7088, -14058,
+    -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835,
+    20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413,
+    -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399,
+    -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026,
+    22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205,
+    -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588,
+    -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050,
+    22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971,
+    -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385, 19366, 14058, 7088, -720,
+    -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743,
+    22531, 22655, 20100, 15168, 8444, 720, -7088, -14058, -19366, -22385, -22756, -20437,
+    -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159,
+    -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124,
+    21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 18963, 21452, 21334, 18734,
+    14066, 7971, 1230, -5333, -10954, -15018, -17125, -17126, -15133, -11488, -6714, -1439,
+    3684, 8058, 11211, 12849, 12877, 11402, 8708, 5207, 1377, -2293, -5377, -7552,
+    -8635, -8597, -7553, -5735, -3453, -1047, 1164, 2919, 4050, 4496, 4301, 3597,
+    2577, 1459, 448, -299, -691, -717, -444, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 609, 1234,
+    1878, 2360, 2512, 2212, 1407, 135, -1477, -3222, -4842, -6062, -6637, -6387,
+    -5234, -3226, -540, 2533, 5617, 8300, 10182, 10942, 10377, 8447, 5290, 1214,
+    -3327, -7789, -11598, -14225, -15261, -14472, -11844, -7593, -2156, 3857, 9730, 14726,
+    18179, 19582, 18660, 15413, 10129, 3364, -4119, -11433, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437,
+    15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159,
+    5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124,
+    -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581,
+    17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004,
+    2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219,
+    -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385,
+    19366, 14058, 7088, -720, -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770,
+    0, 7770, 14621, 19743, 22531, 22655, 20100, 15168, 8444, 720, -7088, -14058,
+    -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835,
+    20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413,
+    -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399,
+    -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026,
+    22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205,
+    -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588,
+    -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050,
+    22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971,
+    -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385, 19366, 14058, 7088, -720,
+    -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743,
+    22531, 22655, 20100, 15168, 8444, 720, -7088, -14058, -19366, -22385, -22756, -20437,
+    -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159,
+    -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124,
+    21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437,
+    15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159,
+    5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124,
+    -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581,
+    17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004,
+    2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219,
+    -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385,
+    19366, 14058, 7088, -720, -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770,
+    0, 7770, 14621, 19743, 22531, 22655, 20100, 15168, 8444, 720, -7088, -14058,
+    -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835,
+    20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413,
+    -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399,
+    -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026,
+    22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205,
+    -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588,
+    -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050,
+    22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971,
+    -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385, 19366, 14058, 7088, -720,
+    -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743,
+    22531, 22655, 20100, 15168, 8444, 720, -7088, -14058, -19366, -22385, -22756, -20437,
+    -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159,
+    -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124,
+    21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581,
+    -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004,
+    -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219,
+    20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385,
+    -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770,
+    0, -7770, -14621, -19743, -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058,
+    19366, 22385, 22756, 20437, 15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835,
+    -20754, -16219, -9766, -2159, 5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413,
+    2875, -5004, -12290, -18124, -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676,
+    17673, 21581, 22937, 21581, 17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926,
+    -21814, -18124, -12290, -5004, 2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892,
+    5704, -2159, -9766, -16219, -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109,
+    15701, 20437, 22756, 22385, 19366, 14058, 7088, -720, -8444, -15168, -20100, -22655,
+    -22531, -19743, -14621, -7770, 0, 7770, 14621, 19743, 22531, 22655, 20100, 15168,
+    8444, 720, -7088, -14058, -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399,
+    13482, 18971, 22216, 22835, 20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026,
+    -22892, -21050, -16720, -10413, -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205,
+    11050, 3588, -4298, -11676, -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588,
+    11050, 17205, 21326, 22926, 21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050,
+    -22892, -22026, -18556, -12892, -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971,
+    13482, 6399, -1440, -9109, -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720,
+    8444, 15168, 20100, 22655, 22531, 19743, 14621, 7770, 0, -7770, -14621, -19743,
+    -22531, -22655, -20100, -15168, -8444, -720, 7088, 14058, 19366, 22385, 22756, 20437,
+    15701, 9109, 1440, -6399, -13482, -18971, -22216, -22835, -20754, -16219, -9766, -2159,
+    5704, 12892, 18556, 22026, 22892, 21050, 16720, 10413, 2875, -5004, -12290, -18124,
+    -21814, -22926, -21326, -17205, -11050, -3588, 4298, 11676, 17673, 21581, 22937, 21581,
+    17673, 11676, 4298, -3588, -11050, -17205, -21326, -22926, -21814, -18124, -12290, -5004,
+    2875, 10413, 16720, 21050, 22892, 22026, 18556, 12892, 5704, -2159, -9766, -16219,
+    -20754, -22835, -22216, -18971, -13482, -6399, 1440, 9109, 15701, 20437, 22756, 22385,
+    19366, 14058, 7088, -720, -8444, -15168, -20100, -22655, -22531, -19743, -14621, -7770,
+    0, 7770, 14621, 19743, 22531, 22655, 20100, 15168, 8444, 720, -7088, -14058,
+    -19366, -22385, -22756, -20437, -15701, -9109, -1440, 6399, 13482, 18971, 22216, 22835,
+    20754, 16219, 9766, 2159, -5704, -12892, -18556, -22026, -22892, -21050, -16720, -10413,
+    -2875, 5004, 12290, 18124, 21814, 22926, 21326, 17205, 11050, 3588, -4298, -11676,
+    -17673, -21581, -22937, -21581, -17673, -11676, -4298, 3588, 11050, 17205, 21326, 22926,
+    21814, 18124, 12290, 5004, -2875, -10413, -16720, -21050, -22892, -22026, -18556, -12892,
+    -5704, 2159, 9766, 16219, 20754, 22835, 22216, 18971, 13482, 6399, -1440, -9109,
+    -15701, -20437, -22756, -22385, -19366, -14058, -7088, 720, 8444, 15168, 20100, 22655,
+    22531, 19743, 14621, 7770, 0, -7770, -14621, -19743, -22531, -22655, -20100, -15168,
+    -8444, -720, 7088, 14058, 18963, 21452, 21334, 18734, 14066, 7971, 1230, -5333,
+    -10954, -15018, -17125, -17126, -15133, -11488, -6714, -1439, 3684, 8058, 11211, 12849,
+    12877, 11402, 8708, 5207, 1377, -2293, -5377, -7552, -8635, -8597, -7553, -5735,
+    -3453, -1047, 1164, 2919, 4050, 4496, 4301, 3597, 2577, 1459, 448, -299,
+    -691, -717, -444, 0,
+};
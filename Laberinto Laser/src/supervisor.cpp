@@ -0,0 +1,103 @@
+#include <esp_task_wdt.h>
+#include "globals.h"
+#include "functions.h"
+#include "tasks.h"
+#include "faults.h"
+#include "checkpoint.h"
+#include "supervisor.h"
+
+struct Heartbeat {
+  volatile bool armed;
+  volatile TickType_t dueTick;
+};
+
+static Heartbeat heartbeats[NUM_HEARTBEATS];
+static const char *const heartbeatNames[HB_LANE_BASE] = {"RF controller", "beam patterns"};
+
+void supervisorInit(void) {
+  for (int i = 0; i < NUM_HEARTBEATS; i++) {
+    heartbeats[i].armed = false;
+    heartbeats[i].dueTick = 0;
+  }
+  // The Arduino core may have set up the TWDT already; then only the
+  // timeout below is not applied.
+  esp_err_t err = esp_task_wdt_init(TASK_WDT_TIMEOUT_S, true);
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+    Serial.printf("Task watchdog init failed (%d)\n", err);
+  }
+}
+
+void heartbeat(uint8_t id, uint32_t nextWithinMs) {
+  heartbeats[id].dueTick = xTaskGetTickCount() + pdMS_TO_TICKS(nextWithinMs);
+  heartbeats[id].armed = true;
+}
+
+void heartbeatIdle(uint8_t id) {
+  heartbeats[id].armed = false;
+}
+
+// One PCF8574 sample. Returns false on a bus error (NACK, timeout); the
+// caller must then ignore *state, so a bad read never costs a life. The
+// fault is reported when it persists and again when the bus comes back.
+bool readBeams(GameLane *lane, uint8_t *state) {
+  static uint16_t consecutiveErrors[NUM_LANES] = {0};
+  static uint32_t faultSinceMs[NUM_LANES] = {0};
+  uint16_t *errors = &consecutiveErrors[lane->id];
+
+  xSemaphoreTake(lane->ioMutex, portMAX_DELAY);
+  uint8_t value = lane->pcf->read8();
+  bool ok = lane->pcf->lastError() == PCF8574_OK && !faultI2cNack();
+  xSemaphoreGive(lane->ioMutex);
+  if (!ok) {
+    if (++*errors == I2C_FAULT_THRESHOLD) {
+      faultSinceMs[lane->id] = millis();
+      laneLog(lane, "I2C fault: %d PCF8574 reads failed, ignoring beam samples", I2C_FAULT_THRESHOLD);
+    }
+    return false;
+  }
+  if (*errors >= I2C_FAULT_THRESHOLD) {
+    laneLog(lane, "I2C recovered after %u failed reads (%lu ms)", *errors,
+            (unsigned long)(millis() - faultSinceMs[lane->id]));
+    faultRecovered(lane, "i2c");
+  }
+  *errors = 0;
+  *state = value | faultStuckBeams(lane);
+  return true;
+}
+
+// Watches every armed heartbeat. It is the only task subscribed to the ESP
+// task watchdog besides the beam pattern task, so if the supervisor itself
+// hangs the chip resets.
+// - quest loop stalled: the lane is restarted through the RF4 path
+// - RF controller or beam patterns stalled: the whole controller restarts
+void supervisorTask(void *pvParameters) {
+  esp_task_wdt_add(NULL);
+  while (1) {
+    esp_task_wdt_reset();
+    faultPollSerial();
+
+    TickType_t now = xTaskGetTickCount();
+    for (int id = 0; id < NUM_HEARTBEATS; id++) {
+      Heartbeat *hb = &heartbeats[id];
+      if (!hb->armed || (int32_t)(now - hb->dueTick) <= 0) continue;
+
+      uint32_t lateMs = (now - hb->dueTick) * portTICK_PERIOD_MS;
+      hb->armed = false;
+      if (id >= HB_LANE_BASE) {
+        GameLane *lane = &lanes[id - HB_LANE_BASE];
+        laneLog(lane, "SUPERVISOR: quest loop stalled (%lu ms overdue) - restarting lane",
+                (unsigned long)lateMs);
+        checkpointAutoResume(lane);
+        emergencyRestartLane(lane);
+        faultRecovered(lane, "stalled quest loop");
+      } else {
+        Serial.printf("SUPERVISOR: %s stalled (%lu ms overdue) - restarting controller\n",
+                      heartbeatNames[id], (unsigned long)lateMs);
+        Serial.flush();
+        for (int l = 0; l < NUM_LANES; l++) checkpointAutoResume(&lanes[l]);
+        ESP.restart();
+      }
+    }
+    vTaskDelay(SUPERVISOR_PERIOD_MS / portTICK_PERIOD_MS);
+  }
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "globals.h"
+
+// Heartbeat slots watched by supervisorTask. A task that must make progress
+// calls heartbeat() with the time within which its next beat is due; a task
+// about to wait for the operator calls heartbeatIdle().
+enum HeartbeatId { HB_RF_CONTROLLER, HB_BEAM_PATTERNS, HB_LANE_BASE };
+#define HB_QUEST(laneId) (HB_LANE_BASE + (laneId))
+#define NUM_HEARTBEATS (HB_LANE_BASE + NUM_LANES)
+
+#define SUPERVISOR_PERIOD_MS   250
+#define TASK_WDT_TIMEOUT_S     5
+// A beam still broken this long after a life was lost is marked out.
+#define BEAM_CLEAR_TIMEOUT_MS  5000
+// Consecutive failed PCF8574 reads before a lane reports a bus fault.
+#define I2C_FAULT_THRESHOLD    5
+
+void supervisorInit(void);
+void supervisorTask(void *pvParameters);
+void heartbeat(uint8_t id, uint32_t nextWithinMs);
+void heartbeatIdle(uint8_t id);
+bool readBeams(GameLane *lane, uint8_t *state);
@@ -0,0 +1,115 @@
+#include "globals.h"
+#include "functions.h"
+#include "taskmem.h"
+#include "sfx.h"
+
+struct SystemTaskMem {
+  StaticTask_t tcb;
+  StackType_t stack[SYSTEM_TASK_STACK];
+};
+
+struct LaneTaskMem {
+  StaticTask_t tcb;
+  StackType_t stack[LANE_TASK_STACK];
+};
+
+struct LaneMem {
+  LaneTaskMem tasks[NUM_LANE_TASKS];
+  StaticQueue_t queue;
+  uint8_t queueStorage[1 * sizeof(MainTaskMsg)];
+  StaticSemaphore_t ioMutex;
+};
+
+static SystemTaskMem systemTaskMem[NUM_SYSTEM_TASKS];
+static LaneMem laneMem[NUM_LANES];
+
+static StaticQueue_t rfEventQueueMem;
+static uint8_t rfEventQueueStorage[NUM_LANES * sizeof(RfEvent)];
+static StaticQueue_t logQueueMem;
+static uint8_t logQueueStorage[LOG_POOL_LINES * sizeof(LogLine)];
+static StaticQueue_t sfxQueueMem;
+static uint8_t sfxQueueStorage[SFX_QUEUE_LEN * sizeof(SfxRequest)];
+static StaticSemaphore_t srMutexMem;
+
+static_assert(sizeof(systemTaskMem) + sizeof(laneMem) + sizeof(rfEventQueueStorage) +
+              sizeof(logQueueStorage) + sizeof(sfxQueueStorage) <= STATIC_RAM_BUDGET,
+              "static task/queue memory exceeds STATIC_RAM_BUDGET");
+
+QueueHandle_t logQueue;
+QueueHandle_t sfxQueue;
+
+static uint32_t bootFreeHeap;
+
+// Creates the shared queues and mutex. Call once, before any task starts.
+void staticMemoryInit(void) {
+  srMutex = xSemaphoreCreateMutexStatic(&srMutexMem);
+  rfEventQueue = xQueueCreateStatic(NUM_LANES, sizeof(RfEvent),
+                                    rfEventQueueStorage, &rfEventQueueMem);
+  logQueue = xQueueCreateStatic(LOG_POOL_LINES, sizeof(LogLine),
+                                logQueueStorage, &logQueueMem);
+  sfxQueue = xQueueCreateStatic(SFX_QUEUE_LEN, sizeof(SfxRequest),
+                                sfxQueueStorage, &sfxQueueMem);
+  Serial.printf("Static task/queue memory: %u bytes of %u budget\n",
+                (unsigned)(sizeof(systemTaskMem) + sizeof(laneMem) +
+                           sizeof(rfEventQueueStorage) + sizeof(logQueueStorage) +
+                           sizeof(sfxQueueStorage)),
+                (unsigned)STATIC_RAM_BUDGET);
+}
+
+TaskHandle_t startSystemTask(SystemTaskId id, TaskFunction_t fn, const char *name,
+                             UBaseType_t priority, BaseType_t core) {
+  return xTaskCreateStaticPinnedToCore(fn, name, SYSTEM_TASK_STACK, NULL, priority,
+                                       systemTaskMem[id].stack, &systemTaskMem[id].tcb, core);
+}
+
+// Re-uses the lane's slot for this task. The previous instance must be gone:
+// phase tasks end suspended and are deleted by reapPhaseTask(), and the
+// emergency restart deletes them from another task on the same core, which
+// FreeRTOS completes immediately.
+bool startLaneTask(GameLane *lane, LaneTaskId id, TaskFunction_t fn, const char *name,
+                   TaskHandle_t *handle) {
+  LaneTaskMem *mem = &laneMem[lane->id].tasks[id];
+  *handle = xTaskCreateStaticPinnedToCore(fn, name, LANE_TASK_STACK, lane, 1,
+                                          mem->stack, &mem->tcb, 1);
+  return *handle != NULL;
+}
+
+QueueHandle_t createLaneQueue(GameLane *lane) {
+  LaneMem *mem = &laneMem[lane->id];
+  return xQueueCreateStatic(1, sizeof(MainTaskMsg), mem->queueStorage, &mem->queue);
+}
+
+// Also called by a forced lane restart: a mutex whose holder was deleted is
+// never given back, so it is created again in the same slot.
+SemaphoreHandle_t createLaneIoMutex(GameLane *lane) {
+  return xSemaphoreCreateMutexStatic(&laneMem[lane->id].ioMutex);
+}
+
+// Ends a phase task. A self-deleted task is only cleaned up later by the
+// idle task, which would race with re-using its static TCB, so the task
+// suspends itself and the coordinator deletes it.
+void finishPhaseTask(void) {
+  vTaskSuspend(NULL);
+}
+
+// Waits for a phase task to reach finishPhaseTask(), then deletes it.
+void reapPhaseTask(TaskHandle_t *handle) {
+  if (*handle == NULL) return;
+  while (eTaskGetState(*handle) != eSuspended) {
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  vTaskDelete(*handle);
+  *handle = NULL;
+}
+
+// Heap after boot should not move between sessions; a falling "min" or a
+// growing delta points at a leak.
+void heapReport(const char *where) {
+  uint32_t freeHeap = esp_get_free_heap_size();
+  if (bootFreeHeap == 0) bootFreeHeap = freeHeap;
+  char line[LOG_LINE_LEN];
+  snprintf(line, sizeof(line), "Heap (%s): free %lu, min %lu, delta since boot %ld",
+           where, (unsigned long)freeHeap, (unsigned long)esp_get_minimum_free_heap_size(),
+           (long)freeHeap - (long)bootFreeHeap);
+  logWrite(line);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "globals.h"
+
+// Every task, queue and mutex is allocated statically here, so heap use
+// after boot stays flat however many games are played.
+
+#define SYSTEM_TASK_STACK 2048
+#define LANE_TASK_STACK   4096
+#define LOG_POOL_LINES    16
+#define LOG_LINE_LEN      128
+#define SFX_QUEUE_LEN     4
+
+// Static RAM reserved for task stacks, TCBs and queue storage. Checked at
+// compile time; scripts/memory_budget.py reports the whole image after build.
+#define STATIC_RAM_BUDGET (52 * 1024)
+
+enum SystemTaskId { SYS_TASK_RF, SYS_TASK_BEAMS, SYS_TASK_LOG, SYS_TASK_SUPERVISOR,
+                    SYS_TASK_SFX, NUM_SYSTEM_TASKS };
+enum LaneTaskId { LANE_TASK_MAIN, LANE_TASK_PREPARATION, LANE_TASK_QUEST,
+                  LANE_TASK_CONSEQUENCE, NUM_LANE_TASKS };
+
+struct LogLine {
+  char text[LOG_LINE_LEN];
+};
+
+extern QueueHandle_t logQueue;
+extern QueueHandle_t sfxQueue;
+
+void staticMemoryInit(void);
+TaskHandle_t startSystemTask(SystemTaskId id, TaskFunction_t fn, const char *name,
+                             UBaseType_t priority, BaseType_t core = 1);
+bool startLaneTask(GameLane *lane, LaneTaskId id, TaskFunction_t fn, const char *name,
+                   TaskHandle_t *handle);
+QueueHandle_t createLaneQueue(GameLane *lane);
+SemaphoreHandle_t createLaneIoMutex(GameLane *lane);
+void finishPhaseTask(void);
+void reapPhaseTask(TaskHandle_t *handle);
+void heapReport(const char *where);
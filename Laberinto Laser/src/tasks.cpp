@@ -1,22 +1,14 @@
 #include "globals.h"
 #include "functions.h"
 #include "tasks.h"
-
-// Game states for main task coordination
-enum GameState {
-    STATE_IDLE,        // Waiting for initial start
-    STATE_PREPARATION,
-    STATE_QUEST,
-    STATE_CONSEQUENCE
-};
-
-// Global variables for task coordination
-volatile GameState currentGameState = STATE_IDLE;
-volatile bool taskCompleted = false;
-volatile bool emergencyRestart = false;
-TaskHandle_t preparationTaskHandle = NULL;
-TaskHandle_t questTaskHandle = NULL;
-TaskHandle_t consequenceTaskHandle = NULL;
+#include "beams.h"
+#include "gametimer.h"
+#include "taskmem.h"
+#include "supervisor.h"
+#include "faults.h"
+#include "sfx.h"
+#include "checkpoint.h"
+#include "align.h"
 
 /*
 A FreeRTOS task runs the code inside its function. When the function returns (reaches the end or executes a return), the task is deleted automatically and its resources are freed.
@@ -33,245 +25,321 @@ Summary:
 
 Task ends → it is deleted.
 To run again, create it again.
+
+All tasks here are created with xTaskCreateStatic (see taskmem.cpp). A phase
+task ends with finishPhaseTask(), which suspends it; mainTask then deletes it
+with reapPhaseTask() before its static slot is used again.
+
+Every game task below receives its GameLane* as pvParameters and keeps all
+of its state there, so one task set runs per lane.
 */
+
+// How long a lane restart waits for the lane's tasks to leave a Wire or
+// DFPlayer call before it deletes them anyway.
+#define RESTART_GRACE_MS 1000
+
+static portMUX_TYPE restartMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Deletes one lane task. A task that reached a safe point and suspended
+// itself is stopped; anything else was still running.
+static void deleteLaneTask(GameLane *lane, TaskHandle_t *handle, const char *name) {
+    if (*handle == NULL) return;
+    bool stopped = eTaskGetState(*handle) == eSuspended;
+    vTaskDelete(*handle);
+    *handle = NULL;
+    laneLog(lane, "%s task %s", name, stopped ? "stopped" : "killed");
+}
+
+// Stop every task of one lane and restart its coordinator. Used by the RF4
+// long press and by the supervisor. Other lanes keep running.
+void emergencyRestartLane(GameLane *lane) {
+    // RF4 and the supervisor can both ask; two restarts at once would
+    // start two coordinators in the same static slot
+    portENTER_CRITICAL(&restartMux);
+    bool busy = lane->restarting;
+    lane->restarting = true;
+    portEXIT_CRITICAL(&restartMux);
+    if (busy) {
+        laneLog(lane, "Restart already in progress - request ignored");
+        return;
+    }
+
+    laneLog(lane, "Stopping all tasks for complete system restart...");
+
+    // Tasks check the flag at their safe points and suspend themselves
+    lane->emergencyRestart = true;
+    heartbeatIdle(HB_QUEST(lane->id));
+    // Disarm the turn clock first: its callback notifies the quest task,
+    // and a notification to a deleted task corrupts the scheduler lists
+    turnClockStop(lane);
+    gameTimerStop(lane->clock.flashTimer);
+
+    // Holding the lane's I/O lock, no task of the lane is inside a Wire
+    // read or a DFPlayer command, so deleting it can't leave the bus or
+    // the player locked. A task stuck in one past the grace time is
+    // deleted anyway.
+    bool ioHeld = xSemaphoreTake(lane->ioMutex, pdMS_TO_TICKS(RESTART_GRACE_MS)) == pdTRUE;
+    if (!ioHeld) {
+        laneLog(lane, "Lane I/O still busy after %d ms - forcing the restart", RESTART_GRACE_MS);
+    }
+    // Hold the shift register lock so no task dies in the middle of srSet()
+    xSemaphoreTake(srMutex, portMAX_DELAY);
+    deleteLaneTask(lane, &lane->mainTaskHandle, "Main");
+    deleteLaneTask(lane, &lane->preparationTaskHandle, "Preparation");
+    deleteLaneTask(lane, &lane->questTaskHandle, "Quest");
+    deleteLaneTask(lane, &lane->consequenceTaskHandle, "Consequence");
+    xSemaphoreGive(srMutex);
+    if (ioHeld) {
+        xSemaphoreGive(lane->ioMutex);
+    } else {
+        lane->ioMutex = createLaneIoMutex(lane); // its holder is gone
+    }
+
+    // Reset all hardware to safe state
+    setRedLighting(lane, false);
+    setGreenLighting(lane, false);
+    beamPatternStop(lane); // a turn cut short leaves the schedule running
+    setLasers(lane, false);
+    alignmentRelease(lane); // RF4 during alignment leaves the status LEDs taken
+    laneLog(lane, "Hardware reset to safe state");
+
+    // Reset lane variables
+    lane->state = STATE_IDLE;
+    lane->systemReady = false;
+    lane->gameTimeLimit = 60000; // Default 1 minute
+    flushMainTaskQueue(lane);
+    laneLog(lane, "Global variables and queue reset");
+
+    // Wait a moment before restarting
+    vTaskDelay(500 / portTICK_PERIOD_MS);
+
+    // Restart main task
+    startLaneTask(lane, LANE_TASK_MAIN, mainTask, "Main Task", &lane->mainTaskHandle);
+    laneLog(lane, "Main task restarted - Emergency restart complete!");
+    lane->restarting = false;
+}
+
+// Safe point for the lane's tasks: outside any Wire, DFPlayer or shift
+// register call. Suspends the caller when a restart is pending.
+static void laneRestartPoint(GameLane *lane) {
+    if (lane->emergencyRestart) vTaskSuspend(NULL);
+}
+
+// Routes every RF event to the lane that owns the channel.
 void rfControllerTask(void *pvParameters) {
     RfEvent event;
     MainTaskMsg msg;
     while (1) {
-        if (xQueueReceive(rfEventQueue, &event, portMAX_DELAY) == pdTRUE) {
+        heartbeat(HB_RF_CONTROLLER, 2000);
+        if (xQueueReceive(rfEventQueue, &event, 1000 / portTICK_PERIOD_MS) == pdTRUE) {
+            GameLane *lane = &lanes[event.channel / RF_CHANNELS_PER_LANE];
+            uint8_t channel = event.channel % RF_CHANNELS_PER_LANE;
+
             if (event.type == LONG_PRESS) {
-                Serial.printf("Long press detected on channel %d\n", event.channel + 1);
+                laneLog(lane, "Long press detected on channel %d", channel + 1);
             } else {
-                Serial.printf("Short press detected on channel %d\n", event.channel + 1);
+                laneLog(lane, "Short press detected on channel %d", channel + 1);
             }
-            
+
             // Check for RF4 emergency kill switch
-            if (event.channel == 3 && event.type == LONG_PRESS) {
-                Serial.println("EMERGENCY RESTART - RF4 long press detected!");
-                Serial.println("Killing all tasks for complete system restart...");
-                
-                emergencyRestart = true;
-                
-                // Kill all active tasks
-                if (mainTaskHandle != NULL) {
-                    vTaskDelete(mainTaskHandle);
-                    mainTaskHandle = NULL;
-                    Serial.println("Main task killed");
-                }
-                if (preparationTaskHandle != NULL) {
-                    vTaskDelete(preparationTaskHandle);
-                    preparationTaskHandle = NULL;
-                    Serial.println("Preparation task killed");
-                }
-                if (questTaskHandle != NULL) {
-                    vTaskDelete(questTaskHandle);
-                    questTaskHandle = NULL;
-                    Serial.println("Quest task killed");
-                }
-                if (consequenceTaskHandle != NULL) {
-                    vTaskDelete(consequenceTaskHandle);
-                    consequenceTaskHandle = NULL;
-                    Serial.println("Consequence task killed");
-                }
-                
-                // Reset all hardware to safe state
-                setRedLighting(false);
-                setGreenLighting(false);
-                setLasers(false);
-                Serial.println("Hardware reset to safe state");
-                
-                // Reset global variables
-                currentGameState = STATE_IDLE;
-                systemReady = false;
-                gameTimeLimit = 60000; // Default 1 minute
-                taskCompleted = false;
-                Serial.println("Global variables and queue reset");
-                
-                // Wait a moment before restarting
-                vTaskDelay(500 / portTICK_PERIOD_MS);
-                
-                // Restart main task
-                xTaskCreatePinnedToCore(mainTask, "Main Task", 4096, NULL, 1, &mainTaskHandle, 1);
-                Serial.println("Main task restarted - Emergency restart complete!");
-                
+            if (channel == 3 && event.type == LONG_PRESS) {
+                laneLog(lane, "EMERGENCY RESTART - RF4 long press detected!");
+                heartbeat(HB_RF_CONTROLLER, 2000 + RESTART_GRACE_MS + 500); // the restart blocks here
+                emergencyRestartLane(lane);
                 continue; // Don't send this message to queue
             }
-            
-            if (event.type == SHORT_PRESS) {
-                pcf.write(event.channel, !pcf.read(event.channel));
-            }
-            msg.channel = event.channel;
+
+            msg.channel = channel;
             msg.type = event.type;
-            
+
             // Check for and remove any old message in the queue
-            if (uxQueueMessagesWaiting(mainTaskQueue) > 0) {
+            if (uxQueueMessagesWaiting(lane->queue) > 0) {
                 MainTaskMsg dummyMsg;
-                xQueueReceive(mainTaskQueue, &dummyMsg, 0); // Remove old message
+                xQueueReceive(lane->queue, &dummyMsg, 0); // Remove old message
             }
-            xQueueSend(mainTaskQueue, &msg, 0); // Send new message
+            xQueueSend(lane->queue, &msg, 0); // Send new message
         }
     }
 }
 
 void mainTask(void *pvParameters) {
-    Serial.println("Main task started - Game coordinator");
-    
+    GameLane *lane = (GameLane *)pvParameters;
+    laneLog(lane, "Main task started - Game coordinator");
+
     // Reset emergency flag if it was set
-    emergencyRestart = false;
-    
+    lane->emergencyRestart = false;
+
     // Safety cleanup: ensure all task handles are NULL if this is a restart
-    preparationTaskHandle = NULL;
-    questTaskHandle = NULL;
-    consequenceTaskHandle = NULL;
-    
+    lane->preparationTaskHandle = NULL;
+    lane->questTaskHandle = NULL;
+    lane->consequenceTaskHandle = NULL;
+
     // Initialize all systems to off state
-    setRedLighting(false);
-    setGreenLighting(false);
-    setLasers(false);
-    systemReady = false;
-    gameTimeLimit = 60000; // Default 1 minute
-    
+    setRedLighting(lane, false);
+    setGreenLighting(lane, false);
+    setLasers(lane, false);
+    lane->systemReady = false;
+    lane->gameTimeLimit = 60000; // Default 1 minute
+
     // Ensure we start in IDLE state
-    currentGameState = STATE_IDLE;
-    
-    Serial.println("System fully reset and ready");
-    
+    lane->state = STATE_IDLE;
+
+    laneLog(lane, "System fully reset and ready");
+
+    // An unfinished session (reset, brownout, RF4) can pick up where it was
+    checkpointOfferResume(lane);
+
+    // At boot the offer runs while setup() still brings up the DFPlayers
+    while (!audioReady) {
+        vTaskDelay(50 / portTICK_PERIOD_MS);
+    }
+
     MainTaskMsg msg;
-    
+
     while (1) {
-        switch (currentGameState) {
+        switch (lane->state) {
             case STATE_IDLE:
-                Serial.println("System ready. Press RF1 (short press) to start preparation...");
-                
+                laneLog(lane, "System ready. Press RF1 (short press) to start preparation...");
+
                 // Wait for RF1 short press to start preparation
-                while (currentGameState == STATE_IDLE) {
-                    if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
+                while (lane->state == STATE_IDLE) {
+                    if (xQueueReceive(lane->queue, &msg, portMAX_DELAY) == pdTRUE) {
                         if (msg.channel == 0 && msg.type == SHORT_PRESS) {
-                            Serial.println("Starting preparation phase...");
-                            currentGameState = STATE_PREPARATION;
+                            laneLog(lane, "Starting preparation phase...");
+                            lane->state = STATE_PREPARATION;
                             break;
                         }
                     }
                 }
-                flushMainTaskQueue();
+                flushMainTaskQueue(lane);
                 break;
-                
+
             case STATE_PREPARATION:
-                flushMainTaskQueue();
+                flushMainTaskQueue(lane);
             // Create preparation task
-                xTaskCreatePinnedToCore(
-                    preparationTask,
-                    "PreparationTask",
-                    4096,
-                    NULL,
-                    1,
-                    &preparationTaskHandle,
-                    1
-                );
-                
+                startLaneTask(lane, LANE_TASK_PREPARATION, preparationTask, "PreparationTask",
+                              &lane->preparationTaskHandle);
+
                 // Wait for preparation to complete
-                while (currentGameState == STATE_PREPARATION) {
+                while (lane->state == STATE_PREPARATION) {
+                    laneRestartPoint(lane);
                     vTaskDelay(100 / portTICK_PERIOD_MS);
                 }
-                Serial.println("Preparation phase completed");
-                flushMainTaskQueue();
+                reapPhaseTask(&lane->preparationTaskHandle);
+                laneLog(lane, "Preparation phase completed");
+                flushMainTaskQueue(lane);
                 break;
-                
+
             case STATE_QUEST:
-                Serial.println("Starting quest phase...");
+                laneLog(lane, "Starting quest phase...");
                 // Create quest task
-                flushMainTaskQueue();
-                xTaskCreatePinnedToCore(
-                    questTask,
-                    "QuestTask",
-                    4096,
-                    NULL,
-                    1,
-                    &questTaskHandle,
-                    1
-                );
-                
+                flushMainTaskQueue(lane);
+                startLaneTask(lane, LANE_TASK_QUEST, questTask, "QuestTask",
+                              &lane->questTaskHandle);
+
                 // Wait for quest to complete
-                while (currentGameState == STATE_QUEST) {
+                while (lane->state == STATE_QUEST) {
+                    laneRestartPoint(lane);
                     vTaskDelay(100 / portTICK_PERIOD_MS);
                 }
-                Serial.println("Quest phase completed");
-                flushMainTaskQueue();
+                reapPhaseTask(&lane->questTaskHandle);
+                laneLog(lane, "Quest phase completed");
+                flushMainTaskQueue(lane);
                 break;
-                
+
             case STATE_CONSEQUENCE:
-                Serial.println("Starting consequence phase...");
+                laneLog(lane, "Starting consequence phase...");
                 // Create consequence task
-                flushMainTaskQueue();
-                xTaskCreatePinnedToCore(
-                    consequenceTask,
-                    "ConsequenceTask",
-                    4096,
-                    NULL,
-                    1,
-                    &consequenceTaskHandle,
-                    1
-                );
-                
+                flushMainTaskQueue(lane);
+                startLaneTask(lane, LANE_TASK_CONSEQUENCE, consequenceTask, "ConsequenceTask",
+                              &lane->consequenceTaskHandle);
+
                 // Wait for consequence to complete
-                while (currentGameState == STATE_CONSEQUENCE) {
+                while (lane->state == STATE_CONSEQUENCE) {
+                    laneRestartPoint(lane);
                     vTaskDelay(100 / portTICK_PERIOD_MS);
                 }
-                Serial.println("Consequence phase completed");
+                reapPhaseTask(&lane->consequenceTaskHandle);
+                laneLog(lane, "Consequence phase completed");
                 break;
         }
-        
+
         vTaskDelay(50 / portTICK_PERIOD_MS);
     }
 }
 
 void preparationTask(void *pvParameters) {
-    Serial.println("Preparation task started");
-    
+    GameLane *lane = (GameLane *)pvParameters;
+    laneLog(lane, "Preparation task started");
+
     // Set all PCF8574 pins to input mode
+    xSemaphoreTake(lane->ioMutex, portMAX_DELAY);
     for (uint8_t i = 0; i < NUM_LASERS; i++) {
-        pcf.write(i, HIGH);
+        lane->pcf->write(i, HIGH);
     }
+    xSemaphoreGive(lane->ioMutex);
     pinMode(LED_BUILTIN, OUTPUT);
 
     // Turn on all lights and lasers immediately when prep starts
-    setRedLighting(true);
-    setGreenLighting(true);
-    setLasers(true);
-    Serial.println("All lights and lasers ON - Preparation started!");
+    setRedLighting(lane, true);
+    setGreenLighting(lane, true);
+    setLasers(lane, true);
+    laneLog(lane, "All lights and lasers ON - Preparation started!");
 
     MainTaskMsg msg;
-    
+
     // --- Time Selection Phase ---
-    Serial.println("Select time mode:");
-    Serial.println("RF1 (long press) = 30 seconds");
-    Serial.println("RF2 (long press) = 1 minute");
-    Serial.println("RF3 (long press) = 1.5 minutes");
-    
+    laneLog(lane, "Select time mode:");
+    laneLog(lane, "RF1 (long press) = 30 seconds");
+    laneLog(lane, "RF2 (long press) = 1 minute");
+    laneLog(lane, "RF3 (long press) = 1.5 minutes");
+#if PER_BEAM_LASERS
+    laneLog(lane, "RF2 (short press) = next beam pattern (now: %s)", lane->beams.pattern->name);
+#else
+    // Relay-only lasers can't run a per-beam schedule, and blinking k3
+    // wears the relay and loads the supply
+    lane->beams.pattern = &beamPatterns[0];
+    laneLog(lane, "Beam pattern: static (relay-only lasers)");
+#endif
+    laneLog(lane, "RF3 (short press) = beam alignment mode");
+
     unsigned long selectedTimeLimit = 70000; // Default 70 seconds
     int blinkCount = 2; // Default for 70 seconds
     bool modeSelected = false;
-    
+
     while (!modeSelected) {
-        if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
+        if (xQueueReceive(lane->queue, &msg, portMAX_DELAY) == pdTRUE) {
+            if (msg.channel == 1 && msg.type == SHORT_PRESS) {
+#if PER_BEAM_LASERS
+                uint8_t next = (lane->beams.pattern - beamPatterns + 1) % NUM_BEAM_PATTERNS;
+                lane->beams.pattern = &beamPatterns[next];
+                laneLog(lane, "Beam pattern: %s", lane->beams.pattern->name);
+#else
+                laneLog(lane, "Beam pattern: static (relay-only lasers, patterns need PER_BEAM_LASERS)");
+#endif
+            }
+            if (msg.channel == 2 && msg.type == SHORT_PRESS) {
+                alignmentMode(lane);
+                laneLog(lane, "Select time mode: RF1/RF2/RF3 (long press), RF3 (short press) = align");
+            }
             if (msg.type == LONG_PRESS) {
                 switch (msg.channel) {
                     case 0: // RF1 - 40 seconds
                         selectedTimeLimit = 40000;
                         blinkCount = 1;
-                        Serial.println("Mode selected: 40 seconds");
+                        laneLog(lane, "Mode selected: 40 seconds");
                         modeSelected = true;
                         break;
                     case 1: // RF2 - 70 seconds
                         selectedTimeLimit = 70000;
                         blinkCount = 2;
-                        Serial.println("Mode selected: 70 seconds");
+                        laneLog(lane, "Mode selected: 70 seconds");
                         modeSelected = true;
                         break;
                     case 2: // RF3 - 90 seconds
                         selectedTimeLimit = 90000;
                         blinkCount = 3;
-                        Serial.println("Mode selected: 90 seconds");
+                        laneLog(lane, "Mode selected: 90 seconds");
                         modeSelected = true;
                         break;
                     // RF4 is reserved for emergency restart, ignore other channels
@@ -279,362 +347,583 @@ void preparationTask(void *pvParameters) {
             }
         }
     }
-    flushMainTaskQueue();
+    flushMainTaskQueue(lane);
     // Confirmation blinks - according to selected time
-    Serial.printf("Confirming selection with %d blinks...\n", blinkCount);
+    laneLog(lane, "Confirming selection with %d blinks...", blinkCount);
     for (int i = 0; i < blinkCount; i++) {
-        setRedLighting(false);
-        setGreenLighting(false);
+        setRedLighting(lane, false);
+        setGreenLighting(lane, false);
         vTaskDelay(300 / portTICK_PERIOD_MS);
-        setRedLighting(true);
-        setGreenLighting(true);
+        setRedLighting(lane, true);
+        setGreenLighting(lane, true);
         vTaskDelay(300 / portTICK_PERIOD_MS);
     }
-    
+
     // Turn off all lights and lasers after confirmation
-    setRedLighting(false);
-    setGreenLighting(false);
-    setLasers(false);
-    
-    Serial.println("Time mode confirmed! All lights and lasers OFF.");
-    Serial.println("Preparation complete! Waiting for RF1 long press to start quest...");
-    
-    // Set global variables for main task
-    gameTimeLimit = selectedTimeLimit;
-    systemReady = true;
-    
+    setRedLighting(lane, false);
+    setGreenLighting(lane, false);
+    setLasers(lane, false);
+
+    laneLog(lane, "Time mode confirmed! All lights and lasers OFF.");
+    laneLog(lane, "Preparation complete! Waiting for RF1 long press to start quest...");
+
+    // Set lane variables for main task
+    lane->gameTimeLimit = selectedTimeLimit;
+    lane->systemReady = true;
+    checkpointSave(lane, CP_READY, 0, 0, 0, true);
+
     // Wait for RF1 long press to transition to quest
     while (1) {
-        if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
+        if (xQueueReceive(lane->queue, &msg, portMAX_DELAY) == pdTRUE) {
             if (msg.channel == 0 && msg.type == LONG_PRESS) {
-                Serial.println("RF1 long press detected - Moving to quest phase!");
-                currentGameState = STATE_QUEST;
+                laneLog(lane, "RF1 long press detected - Moving to quest phase!");
+                lane->state = STATE_QUEST;
                 break;
             }
         }
     }
-    flushMainTaskQueue();
+    flushMainTaskQueue(lane);
     // Task completes here - preparation is done
-    vTaskDelete(NULL);
+    finishPhaseTask();
+}
+
+// Changeover between two players. Result cue, laser re-arm, briefing and
+// the operator's decision overlap instead of running one after the other.
+// Cue waits run from the moment the track starts. They are the track
+// lengths in GAME_INSTRUCTIONS.md plus a buffer; the durations in
+// audioTracks don't match the cards and must not be used as waits. With
+// the next player queued the briefing is skipped and only a short laser
+// self-check separates the result cue from the countdown.
+#define CUE_WIN_MS      13000  // win audio (12 s) plus buffer
+#define CUE_LOST_MS     10000  // last life audio (9 s) plus buffer
+#define CUE_TIMEOUT_MS  12000  // timeout audio (11 s) plus buffer
+#define BRIEFING_MS     15000  // after-turn audio (12 s) plus buffer
+#define SELF_CHECK_MS   1500
+
+static void changeoverInput(GameLane *lane, Changeover *co, const MainTaskMsg &msg) {
+    if (msg.channel == 0 && msg.type == SHORT_PRESS && !co->nextQueued) {
+        co->nextQueued = true;
+        laneLog(lane, "Next player queued");
+    } else if (msg.channel == 2 && msg.type == LONG_PRESS) {
+        co->endRequested = true;
+        laneLog(lane, "RF3 long press detected - Ending game session");
+    }
+}
+
+// Waits until untilMs while taking operator input. Returns early if the
+// session end is requested.
+static void changeoverWait(GameLane *lane, Changeover *co, unsigned long untilMs) {
+    MainTaskMsg msg;
+    while (!co->endRequested) {
+        laneRestartPoint(lane);
+        long remaining = (long)(untilMs - millis());
+        if (remaining <= 0) break;
+        if (xQueueReceive(lane->queue, &msg, remaining / portTICK_PERIOD_MS) == pdTRUE) {
+            changeoverInput(lane, co, msg);
+        }
+    }
+}
+
+// Samples the grid while the briefing plays. Beams that are intact again
+// (realigned, or marked out during play) rejoin detection. Working beams
+// still broken at the end are reported but stay armed.
+static void changeoverSelfCheck(GameLane *lane, Changeover *co, bool *laserWorking,
+                                uint8_t *workingMask, unsigned long untilMs) {
+    uint8_t state = 0;
+    bool sampled = false;
+    while (!co->endRequested && (long)(untilMs - millis()) > 0) {
+        uint8_t sample;
+        if (readBeams(lane, &sample)) {
+            state = sample;
+            sampled = true;
+        }
+        changeoverWait(lane, co, min(untilMs, millis() + 250));
+    }
+    if (!sampled) return;
+    for (uint8_t i = 0; i < NUM_LASERS; i++) {
+        bool intact = !(state & (1 << i));
+        if (intact && !laserWorking[i]) {
+            laserWorking[i] = true;
+            *workingMask |= (1 << i);
+            laneLog(lane, "Self-check: beam %d OK again - back in the game", i + 1);
+        } else if (!intact && laserWorking[i]) {
+            laneLog(lane, "Self-check: beam %d not clear", i + 1);
+        }
+    }
+}
+
+// One detection sample: returns the working beams that are broken. Only
+// beams armed both before and after the sample count: a beam switched on
+// or off by the pattern engine in between is skipped for this sample.
+// A failed bus read counts as no beam data.
+uint8_t questDetect(GameLane *lane, uint8_t workingMask, uint8_t *pcfState) {
+    uint8_t armed = beamArmedMask(lane);
+    if (!readBeams(lane, pcfState)) armed = 0;
+    armed &= beamArmedMask(lane);
+    return *pcfState & armed & workingMask;
+}
+
+// The penalty-free part of one quest loop iteration: one detection sample,
+// operator input, turn clock and checkpoint. Returns at the first event;
+// penalties and the turn end are up to the caller. The benchmark times
+// this same function.
+QuestEvent questStep(GameLane *lane, QuestStep *step) {
+    lane->beams.urgency = turnClockElapsedMs(lane) * 100 / step->limitMs;
+    step->hitMask = questDetect(lane, step->workingMask, &step->pcfState);
+
+    // Check for RF2 events (lose life or win) and RF3 events (end game)
+    bool rf2Event = false;
+    MainTaskMsg rfMsg;
+    while (uxQueueMessagesWaiting(lane->queue) > 0) {
+        if (xQueueReceive(lane->queue, &rfMsg, 0) == pdTRUE) {
+            if (rfMsg.channel == 1) { // RF2
+                if (rfMsg.type == SHORT_PRESS) {
+                    // Lose a life by RF2 short press
+                    rf2Event = true;
+                    break;
+                } else if (rfMsg.type == LONG_PRESS) {
+                    return QUEST_WON; // Win by RF2 long press
+                }
+            } else if (rfMsg.channel == 2) { // RF3 - End game
+                if (rfMsg.type == LONG_PRESS) return QUEST_END;
+            } else if (rfMsg.channel == 0) { // RF1 - queue the next player
+                changeoverInput(lane, step->co, rfMsg);
+            }
+        }
+    }
+    flushMainTaskQueue(lane);
+    if (step->hitMask || rf2Event) return QUEST_HIT;
+
+    int milestone = turnClockTakeMilestone(lane);
+    if (milestone >= 0) {
+        laneLog(lane, "Player %d: %lu seconds left!", step->playerNumber,
+                (unsigned long)(turnMilestonesMs[milestone] / 1000));
+        sfxPlay(lane, SFX_WARNING);
+        turnWarningFlash(lane, 500);
+    }
+    if (turnClockExpired(lane)) return QUEST_TIMEOUT;
+
+    // RTC copy only: the remaining time survives a reset to the second
+    if (millis() - step->lastCheckpointMs >= 1000) {
+        checkpointSave(lane, CP_TURN, step->playerNumber, step->lives,
+                       turnClockRemainingMs(lane), false);
+        step->lastCheckpointMs = millis();
+    }
+    flushMainTaskQueue(lane);
+    return QUEST_CONTINUE;
 }
 
 void questTask(void *pvParameters) {
-    Serial.println("Quest task started - Game phase");
-    
-    // --- Instructions Phase at start of quest ---
-    Serial.println("Playing instructions automatically...");
-    playAudioInterrupt(1); // Play instructions immediately
-    
-    Serial.println("Instructions playing. Press RF1 (short press) to replay instructions, RF1 (long press) to start game...");
-    
+    GameLane *lane = (GameLane *)pvParameters;
+    laneLog(lane, "Quest task started - Game phase");
+
+    // A turn resumed from a checkpoint skips the instructions and the wait
+    // for player 1
+    GameCheckpoint resume;
+    bool resuming = checkpointTakeResume(lane, &resume);
+
     MainTaskMsg msg;
+    // --- Instructions Phase at start of quest ---
+    if (!resuming) {
+        laneLog(lane, "Playing instructions automatically...");
+        playAudioInterrupt(lane, 1); // Play instructions immediately
+
+        laneLog(lane, "Instructions playing. Press RF1 (short press) to replay instructions, RF1 (long press) to start game...");
+    }
+
     // Instructions loop
-    while (1) {
-        if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
+    while (!resuming) {
+        if (xQueueReceive(lane->queue, &msg, portMAX_DELAY) == pdTRUE) {
             if (msg.channel == 0 && msg.type == SHORT_PRESS) {
-                Serial.println("Replaying instructions...");
-                playAudioInterrupt(1); // Replay instructions
+                laneLog(lane, "Replaying instructions...");
+                playAudioInterrupt(lane, 1); // Replay instructions
             }
             if (msg.channel == 0 && msg.type == LONG_PRESS) {
-                Serial.println("Instructions finished - Starting game!");
+                laneLog(lane, "Instructions finished - Starting game!");
                 break; // Exit instructions loop and start game
             }
         }
     }
-    flushMainTaskQueue();
+    flushMainTaskQueue(lane);
     // --- Game Phase starts here ---
-    
+
     // Turn on lasers for the first game setup
-    setLasers(true);
-    Serial.println("Lasers turned ON - Game ready to start");
-    
+    setLasers(lane, true);
+    laneLog(lane, "Lasers turned ON - Game ready to start");
+
     // Perform laser check after preparation is complete
+    beamPatternStop(lane); // whole grid lit for the check
+    vTaskDelay(BEAM_SETTLE_MIN_MS / portTICK_PERIOD_MS);
     bool laserWorking[NUM_LASERS];
-    uint8_t pcfState = pcf.read8();
+    uint8_t workingMask = 0;
+    uint8_t pcfState = 0xFF; // all broken if the bus never answers
+    for (int attempt = 0; attempt < 3 && !readBeams(lane, &pcfState); attempt++) {
+        vTaskDelay(20 / portTICK_PERIOD_MS);
+    }
     for (uint8_t i = 0; i < NUM_LASERS; i++) {
         laserWorking[i] = !(pcfState & (1 << i));
+        if (laserWorking[i]) workingMask |= (1 << i);
     }
 
-    Serial.print("Final laser working state: ");
+    char laserReport[NUM_LASERS * 7 + 1];
+    laserReport[0] = '\0';
     for (uint8_t i = 0; i < NUM_LASERS; i++) {
-        Serial.print(laserWorking[i] ? "OK " : "BROKEN ");
+        strcat(laserReport, laserWorking[i] ? "OK " : "BROKEN ");
     }
-    Serial.println();
+    laneLog(lane, "Final laser working state: %s", laserReport);
+    beamCharacterizeSettle(lane, workingMask);
+    laneLog(lane, "Beam pattern: %s", lane->beams.pattern->name);
 
-    const int LIVES_PER_PLAYER = 3;
-    const unsigned long PLAYER_TIME_LIMIT = gameTimeLimit;
+    const unsigned long PLAYER_TIME_LIMIT = lane->gameTimeLimit;
 
-    int playerNumber = 1;
-    flushMainTaskQueue();
+    int playerNumber = resuming ? resume.playerNumber : 1;
+    unsigned long resultCueEndMs = 0; // when the turn's result cue ends
+    Changeover co = {false, false};
+    unsigned long turnEndMs = 0; // 0: no changeover in progress
+    lane->changeoverCount = 0;
+    lane->changeoverTotalMs = 0;
+    lane->changeoverMinMs = 0;
+    lane->changeoverMaxMs = 0;
+    flushMainTaskQueue(lane);
     while (1) { // Infinite player loop
         // Reset lighting and lasers for new player
-        setLasers(true);
-        playAudioInterrupt(11);
+        setLasers(lane, true);
+        playAudioInterrupt(lane, 11);
         // For first player, wait for RF1 to start. For subsequent players, start automatically
-        if (playerNumber == 1) {
-            flushMainTaskQueue();
-            Serial.printf("Waiting for player %d to start (short press RF1)...\n", playerNumber);
+        if (playerNumber == 1 && !resuming) {
+            flushMainTaskQueue(lane);
+            laneLog(lane, "Waiting for player %d to start (short press RF1)...", playerNumber);
             while (1) {
-                if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
+                if (xQueueReceive(lane->queue, &msg, portMAX_DELAY) == pdTRUE) {
                     if (msg.channel == 0 && msg.type == SHORT_PRESS) {
                         break;
                     } else if (msg.channel == 2 && msg.type == LONG_PRESS) {
                         // RF3 can end game even while waiting for player to start
-                        Serial.println("RF3 long press detected - Ending game!");
-                        currentGameState = STATE_CONSEQUENCE;
-                        vTaskDelete(NULL); // Exit quest task
+                        laneLog(lane, "RF3 long press detected - Ending game!");
+                        lane->state = STATE_CONSEQUENCE;
+                        finishPhaseTask(); // Exit quest task
                         return;
                     }
                 }
             }
         } else {
             // For subsequent players, they start automatically after decision
-            Serial.printf("Player %d starting automatically...\n", playerNumber);
+            laneLog(lane, "Player %d starting automatically...", playerNumber);
         }
-        flushMainTaskQueue();
-        setRedLighting(false);
-        setGreenLighting(false);
+        flushMainTaskQueue(lane);
+        setRedLighting(lane, false);
+        setGreenLighting(lane, false);
         int lives = LIVES_PER_PLAYER;
-        unsigned long startTime = millis();
+        uint32_t usedMs = 0;
+        if (resuming) {
+            lives = resume.lives;
+            usedMs = PLAYER_TIME_LIMIT - resume.remainingMs;
+            laneLog(lane, "Resuming player %d: %d lives, %lu ms left", playerNumber, lives,
+                    (unsigned long)resume.remainingMs);
+            resuming = false;
+        }
+        // RTC copy now, flash copy after the countdown: an NVS write stalls
+        // the sound task and would break up the ticks
+        checkpointSave(lane, CP_TURN, playerNumber, lives, PLAYER_TIME_LIMIT - usedMs, false);
         bool playerWon = false;
         bool gameEnded = false; // Track if game was ended early with RF3
 
         // Play countdown audio for player start (audio 7: start turn)
-        Serial.printf("Player %d get ready! Playing countdown...\n", playerNumber);
-        playAudioInterrupt(7); // Audio 07 - start turn
-        flushMainTaskQueue();
-        // Wait 6 seconds for the countdown audio to complete
-        vTaskDelay(6000 / portTICK_PERIOD_MS);
-        playAudioInterrupt(13); // Audio 13 - all for now
-        Serial.printf("Player %d started!\n", playerNumber);
-        flushMainTaskQueue();
-        while (lives > 0 && (millis() - startTime) < PLAYER_TIME_LIMIT && !playerWon && !gameEnded) {
-            // Check for laser interruption
-            pcfState = pcf.read8();
-            bool anyInterrupted = false;
-            for (uint8_t i = 0; i < NUM_LASERS; i++) {
-                if (laserWorking[i] && (pcfState & (1 << i))) {
-                    anyInterrupted = true;
-                    break;
-                }
+        laneLog(lane, "Player %d get ready! Playing countdown...", playerNumber);
+        playAudioInterrupt(lane, 7); // Audio 07 - start turn
+        flushMainTaskQueue(lane);
+        // Wait 6 seconds for the countdown audio to complete, ticking each second
+        for (int i = 0; i < 6; i++) {
+            sfxPlay(lane, SFX_TICK);
+            vTaskDelay(1000 / portTICK_PERIOD_MS);
+        }
+        checkpointSave(lane, CP_TURN, playerNumber, lives, PLAYER_TIME_LIMIT - usedMs, true);
+        playAudioInterrupt(lane, 13); // Audio 13 - all for now
+        laneLog(lane, "Player %d started!", playerNumber);
+        // The clock starts after the countdown and wakes this task the
+        // moment the time is up or a warning milestone is reached.
+        turnClockStart(lane, PLAYER_TIME_LIMIT, usedMs);
+        if (turnEndMs != 0) {
+            recordChangeover(lane, millis() - turnEndMs);
+            turnEndMs = 0;
+        }
+        co.nextQueued = false;
+        beamPatternStart(lane);
+        flushMainTaskQueue(lane);
+        QuestStep step;
+        step.playerNumber = playerNumber;
+        step.limitMs = PLAYER_TIME_LIMIT;
+        step.co = &co;
+        step.lastCheckpointMs = millis();
+        while (lives > 0 && !turnClockExpired(lane) && !playerWon && !gameEnded) {
+            heartbeat(HB_QUEST(lane->id), 1000);
+            laneRestartPoint(lane);
+            uint32_t hangMs = faultTakeHang(lane);
+            if (hangMs) vTaskDelay(hangMs / portTICK_PERIOD_MS);
+            unsigned long loopStartUs = micros();
+            step.lives = lives;
+            step.workingMask = workingMask;
+            QuestEvent event = questStep(lane, &step);
+            if (event == QUEST_CONTINUE) {
+                // Only penalty-free iterations count towards loop cost
+                uint32_t loopUs = micros() - loopStartUs;
+                lane->loopCount++;
+                lane->loopTotalUs += loopUs;
+                if (loopUs > lane->loopMaxUs) lane->loopMaxUs = loopUs;
+                // Sleep until the next poll, or until the turn clock wakes us
+                ulTaskNotifyTake(pdTRUE, 50 / portTICK_PERIOD_MS);
+                continue;
+            }
+            if (event == QUEST_WON) {
+                playerWon = true;
+                laneLog(lane, "Player %d wins!", playerNumber);
+                playAudioInterrupt(lane, 5); // Audio 05 - won
+                resultCueEndMs = millis() + CUE_WIN_MS;
+                break;
             }
+            if (event == QUEST_END) {
+                laneLog(lane, "RF3 long press detected - Ending game!");
+                gameEnded = true;
+                break;
+            }
+            if (event == QUEST_TIMEOUT) {
+                laneLog(lane, "Player %d ran out of time! (timer fired %lu us late)",
+                        playerNumber, (unsigned long)lane->clock.lateUs);
+                // Don't play timeout audio here - handle it in results section
+                break;
+            }
+            // QUEST_HIT: lose a life by laser interruption or RF2 short press
+            lives--;
+            laneLog(lane, "Player %d lost a life! Lives left: %d (beams 0x%02X)",
+                    playerNumber, lives, step.hitMask);
 
-            // Check for RF2 events (lose life or win) and RF3 events (end game)
-            bool rf2Event = false;
-            bool gameEnded = false;
-            anyInterrupted = false;
-            MainTaskMsg rfMsg;
-            //flushMainTaskQueue();
-            while (uxQueueMessagesWaiting(mainTaskQueue) > 0) {
-                if (xQueueReceive(mainTaskQueue, &rfMsg, 0) == pdTRUE) {
-                    if (rfMsg.channel == 1) { // RF2
-                        if (rfMsg.type == SHORT_PRESS) {
-                            // Lose a life by RF2 short press
-                            rf2Event = true;
-                            break;
-                        } else if (rfMsg.type == LONG_PRESS) {
-                            // Win by RF2 long press
-                            playerWon = true;
-                            Serial.printf("Player %d wins!\n", playerNumber);
-                            playAudioInterrupt(5); // Audio 05 - won
-                            break;
-                        }
-                    } else if (rfMsg.channel == 2) { // RF3 - End game
-                        if (rfMsg.type == LONG_PRESS) {
-                            Serial.println("RF3 long press detected - Ending game!");
-                            gameEnded = true;
-                            break;
-                        }
-                    }
-                }
+            // The hit sound can't wait for the DFPlayer
+            sfxPlay(lane, SFX_HIT);
+            // Penalty audio and beam clearing don't count against the player
+            turnClockPause(lane);
+            heartbeat(HB_QUEST(lane->id), 15000);
+            // RTC copy only: the flash copy waits until the penalty sounds are over
+            checkpointSave(lane, CP_TURN, playerNumber, lives, turnClockRemainingMs(lane), false);
+            beamPatternStop(lane);
+            blinkLasers(lane, 3); // Blink lasers 3 times
+
+            if (lives == 2){
+                playAudioInterrupt(lane, 2);
+                vTaskDelay(7000 / portTICK_PERIOD_MS);
+                playAudioInterrupt(lane, 12);
+            } else if (lives == 1) {
+                playAudioInterrupt(lane, 3);
+                vTaskDelay(7000 / portTICK_PERIOD_MS);
+                playAudioInterrupt(lane, 10);
+            } else {
+                playAudioInterrupt(lane, 4);
+                resultCueEndMs = millis() + CUE_LOST_MS;
+                vTaskDelay(5000 / portTICK_PERIOD_MS);
             }
-            if (playerWon) break;
-            if (gameEnded) break; // Exit if RF3 end game was pressed
-            flushMainTaskQueue();
-            // Lose a life by laser interruption or RF2 short press
-            if (anyInterrupted || rf2Event) {
-                lives--;
-                Serial.printf("Player %d lost a life! Lives left: %d\n", playerNumber, lives);
-
-                blinkLasers(3); // Blink lasers 3 times
-
-                if (lives == 2){
-                    playAudioInterrupt(2);
-                    vTaskDelay(7000 / portTICK_PERIOD_MS);
-                    playAudioInterrupt(12);
-                } else if (lives == 1) {
-                    playAudioInterrupt(3);
-                    vTaskDelay(7000 / portTICK_PERIOD_MS);
-                    playAudioInterrupt(10);
-                } else {
-                    playAudioInterrupt(4);
-                    vTaskDelay(5000 / portTICK_PERIOD_MS);
+            // Wait for all lasers to clear and RF2 to be released. A beam
+            // that stays broken (knocked out of alignment) is marked out
+            // after BEAM_CLEAR_TIMEOUT_MS so the game can go on. If the
+            // beams could not be read at all in that time, the lane is
+            // handed to the supervisor instead.
+            unsigned long clearStart = millis();
+            bool anyRead = false;
+            uint8_t stillBroken = 0;
+            while (1) {
+                if (readBeams(lane, &pcfState)) {
+                    anyRead = true;
+                    stillBroken = pcfState & workingMask;
+                    if (!stillBroken) break;
                 }
-                // Wait for all lasers to clear and RF2 to be released
+                if (millis() - clearStart >= BEAM_CLEAR_TIMEOUT_MS) break;
+                heartbeat(HB_QUEST(lane->id), 1000);
+                laneRestartPoint(lane);
+                vTaskDelay(50 / portTICK_PERIOD_MS);
+            }
+            if (!anyRead) {
+                laneLog(lane, "Beams unreadable for %d ms - leaving the lane to the supervisor",
+                        BEAM_CLEAR_TIMEOUT_MS);
+                heartbeat(HB_QUEST(lane->id), 0); // overdue at once: restarts this lane
                 while (1) {
-                    pcfState = pcf.read8();
-                    bool stillInterrupted = false;
-                    for (uint8_t i = 0; i < NUM_LASERS; i++) {
-                        if (laserWorking[i] && (pcfState & (1 << i))) {
-                            stillInterrupted = true;
-                            break;
-                        }
-                    }
-                    if (!stillInterrupted) break;
+                    laneRestartPoint(lane);
                     vTaskDelay(50 / portTICK_PERIOD_MS);
                 }
             }
-
-            // Time check
-            if ((millis() - startTime) >= PLAYER_TIME_LIMIT) {
-                Serial.printf("Player %d ran out of time!\n", playerNumber);
-                // Don't play timeout audio here - handle it in results section
-                break;
+            if (stillBroken) {
+                for (uint8_t i = 0; i < NUM_LASERS; i++) {
+                    if (stillBroken & (1 << i)) {
+                        laserWorking[i] = false;
+                        laneLog(lane, "Beam %d still broken after %d ms - marked out, game continues",
+                                i + 1, BEAM_CLEAR_TIMEOUT_MS);
+                    }
+                }
+                workingMask &= ~stillBroken;
+                faultRecovered(lane, "stuck beam");
+            }
+            checkpointSave(lane, CP_TURN, playerNumber, lives, turnClockRemainingMs(lane), true);
+            if (lives > 0) {
+                beamPatternStart(lane);
+                turnClockResume(lane);
             }
-            flushMainTaskQueue();
-            vTaskDelay(50 / portTICK_PERIOD_MS);
         }
+        turnClockStop(lane);
+        heartbeatIdle(HB_QUEST(lane->id));
+        // A reset from here on resumes with the next player
+        checkpointSave(lane, CP_TURN, playerNumber + 1, LIVES_PER_PLAYER, PLAYER_TIME_LIMIT, true);
 
         // After game ends, turn off lasers
-        setLasers(false);
-        flushMainTaskQueue();
+        turnEndMs = millis();
+        beamPatternStop(lane);
+        setLasers(lane, false);
+        reportLoopStats(lane);
+        // No queue flush from here on: an RF1 press now queues the next player
         // Store game result and handle audio/lighting
         if (gameEnded) {
             // Game ended by RF3 - go directly to consequence phase
-            Serial.printf("Player %d ended the game early with RF3.\n", playerNumber);
-            setRedLighting(false);
-            setGreenLighting(false);
-            
+            laneLog(lane, "Player %d ended the game early with RF3.", playerNumber);
+            setRedLighting(lane, false);
+            setGreenLighting(lane, false);
+
             // Move directly to consequence phase (no audio here)
-            Serial.println("Moving to consequence phase...");
-            currentGameState = STATE_CONSEQUENCE;
-            vTaskDelete(NULL); // Exit quest task
+            laneLog(lane, "Moving to consequence phase...");
+            lane->state = STATE_CONSEQUENCE;
+            finishPhaseTask(); // Exit quest task
             return;
-            
-        } else if (playerWon) {
-            setGreenLighting(true);
-            setRedLighting(false);
-            
-            // Wait for win audio to complete (audio 5 = 12 seconds) plus buffer
-            vTaskDelay(13000 / portTICK_PERIOD_MS); // Wait 13 seconds for audio to complete
-            Serial.println("Playing next player preparation audio...");
-            playAudioInterrupt(8); // Audio 08 - after turn
-            
+        }
+
+        // --- Changeover pipeline ---
+        // 1. Result cue (lights + audio) while the player leaves the maze,
+        //    until the result track ends.
+        // 2. Briefing for the next player, skipped when the next player is
+        //    already queued; the lasers are re-armed and self-checked.
+        // The operator can queue the next player or end the session at any
+        // point, even during the turn that just ended.
+        if (playerWon) {
+            setGreenLighting(lane, true);
+            setRedLighting(lane, false);
+            // win audio already started in the loop
         } else if (lives == 0) {
             // Player lost all lives - red lighting already set during life loss
-            setRedLighting(true);
-            setGreenLighting(false);
-            
-            // Wait for life loss audio to complete (audio 4 = 9 seconds) plus buffer
-            vTaskDelay(10000 / portTICK_PERIOD_MS); // Wait 10 seconds for audio to complete
-            Serial.println("Playing next player preparation audio...");
-            playAudioInterrupt(8); // Audio 08 - after turn
-            
-        } else if ((millis() - startTime) >= PLAYER_TIME_LIMIT) {
+            setRedLighting(lane, true);
+            setGreenLighting(lane, false);
+            // last-life audio already started with the penalty
+        } else {
             // Timeout case - red lighting and timeout audio
-            setRedLighting(true);
-            setGreenLighting(false);
-            
-            Serial.println("Playing timeout audio...");
-            playAudioInterrupt(6); // Audio 06 - timeout
-            
-            // Wait for timeout audio to complete (audio 6 = 11 seconds) plus buffer
-            vTaskDelay(12000 / portTICK_PERIOD_MS); // Wait 12 seconds for audio to complete
-            Serial.println("Playing next player preparation audio...");
-            playAudioInterrupt(8); // Audio 08 - after turn
+            setRedLighting(lane, true);
+            setGreenLighting(lane, false);
+            laneLog(lane, "Playing timeout audio...");
+            playAudioInterrupt(lane, 6); // Audio 06 - timeout
+            resultCueEndMs = millis() + CUE_TIMEOUT_MS;
         }
+        laneLog(lane, "Player %d's turn is over.", playerNumber);
+        changeoverWait(lane, &co, resultCueEndMs);
 
-        Serial.printf("Player %d's turn is over.\n", playerNumber);
-        
-        // Wait for after-turn audio to complete (audio 8 = 12 seconds) plus buffer
-        vTaskDelay(15000 / portTICK_PERIOD_MS);
-        
-        // Automatic labyrinth restart - turn off all lights after restart audio
-        setRedLighting(false);
-        setGreenLighting(false);
-        Serial.println("Labyrinth restarted automatically - Lights turned OFF");
-        
-        // Turn on lasers for next player
-        setLasers(true);
-        Serial.println("Lasers turned ON - Ready for next player");
-        
-        // Check if user wants to end the game or continue with next player
-        Serial.println("Options:");
-        Serial.println("RF1 (short press) - Next player");
-        Serial.println("RF3 (long press) - End game and go to consequence phase");
-        myDFPlayer.play(12);
-        bool nextPlayerDecided = false;
-        flushMainTaskQueue();
-        while (!nextPlayerDecided) {
-            if (xQueueReceive(mainTaskQueue, &msg, portMAX_DELAY) == pdTRUE) {
-                if (msg.channel == 0 && msg.type == SHORT_PRESS) {
-                    // Continue with next player - automatically start their turn
-                    playerNumber++;
-                    Serial.printf("Starting player %d automatically...\n", playerNumber);
-                    nextPlayerDecided = true;
-                    // No need to wait for another RF1 press - go directly to game sequence
-                } else if (msg.channel == 2 && msg.type == LONG_PRESS) {
-                    // End game and go to consequence
-                    Serial.println("Ending game session - Moving to consequence phase...");
-                    currentGameState = STATE_CONSEQUENCE;
-                    vTaskDelete(NULL); // Exit quest task
-                    return;
-                }
+        if (!co.endRequested) {
+            unsigned long checkEndMs;
+            if (co.nextQueued) {
+                // The next player is waiting: no briefing
+                checkEndMs = millis() + SELF_CHECK_MS;
+                laneLog(lane, "Next player queued - skipping the briefing");
+            } else {
+                laneLog(lane, "Playing next player preparation audio...");
+                playAudioInterrupt(lane, 8); // Audio 08 - after turn
+                checkEndMs = millis() + BRIEFING_MS;
+            }
+            setLasers(lane, true);
+            beamPatternStop(lane);
+            laneLog(lane, "Lasers turned ON - self-check");
+            changeoverSelfCheck(lane, &co, laserWorking, &workingMask, checkEndMs);
+        }
+
+        if (co.endRequested) {
+            // End game and go to consequence
+            laneLog(lane, "Ending game session - Moving to consequence phase...");
+            lane->state = STATE_CONSEQUENCE;
+            finishPhaseTask(); // Exit quest task
+            return;
+        }
+
+        // Automatic labyrinth restart - turn off all lights after briefing
+        setRedLighting(lane, false);
+        setGreenLighting(lane, false);
+        laneLog(lane, "Labyrinth restarted automatically - Lights turned OFF");
+
+        if (!co.nextQueued) {
+            // Check if user wants to end the game or continue with next player
+            laneLog(lane, "Options:");
+            laneLog(lane, "RF1 (short press) - Next player");
+            laneLog(lane, "RF3 (long press) - End game and go to consequence phase");
+            playTrack(lane, 12);
+            while (!co.nextQueued && !co.endRequested) {
+                changeoverWait(lane, &co, millis() + 60000);
+            }
+            if (co.endRequested) {
+                laneLog(lane, "Ending game session - Moving to consequence phase...");
+                lane->state = STATE_CONSEQUENCE;
+                finishPhaseTask(); // Exit quest task
+                return;
             }
         }
-        flushMainTaskQueue();
+        // Continue with next player - automatically start their turn
+        playerNumber++;
+        laneLog(lane, "Starting player %d automatically...", playerNumber);
         // Continue the loop for next player (don't move to consequence yet)
     }
 }
 
 void consequenceTask(void *pvParameters) {
-    flushMainTaskQueue();
-    Serial.println("Consequence task started - Game ending phase");
-    
+    GameLane *lane = (GameLane *)pvParameters;
+    flushMainTaskQueue(lane);
+    laneLog(lane, "Consequence task started - Game ending phase");
+    checkpointClear(lane);
+    reportChangeoverStats(lane);
+    sfxReportLatency(lane);
+
     // Turn off lasers immediately
-    setLasers(false);
-    Serial.println("Lasers turned OFF");
-    
+    setLasers(lane, false);
+    laneLog(lane, "Lasers turned OFF");
+
     // Turn on both lights (red and green)
-    setRedLighting(true);
-    setGreenLighting(true);
-    Serial.println("Both red and green lights turned ON");
-    
+    setRedLighting(lane, true);
+    setGreenLighting(lane, true);
+    laneLog(lane, "Both red and green lights turned ON");
+
     // Force stop any ongoing audio by playing a working track first, then play goodbye
-    Serial.println("Ensuring audio is ready...");
-    playAudioInterrupt(9); // Track 9 - goodbye audio (confirmed working)
-    Serial.println("Playing goodbye audio (track 9)...");
-    
+    laneLog(lane, "Ensuring audio is ready...");
+    playAudioInterrupt(lane, 9); // Track 9 - goodbye audio (confirmed working)
+    laneLog(lane, "Playing goodbye audio (track 9)...");
+
     unsigned long lastAudioTime = millis();
     const unsigned long AUDIO_REPEAT_INTERVAL = 20000; // 20 seconds
-    
-    Serial.println("Game ended. Press RF1 (long press) to restart preparation phase...");
-    
+
+    laneLog(lane, "Game ended. Press RF1 (long press) to restart preparation phase...");
+
     MainTaskMsg msg;
     while (1) {
         // Check for RF1 long press to restart preparation
-        if (xQueueReceive(mainTaskQueue, &msg, 100 / portTICK_PERIOD_MS) == pdTRUE) {
+        if (xQueueReceive(lane->queue, &msg, 100 / portTICK_PERIOD_MS) == pdTRUE) {
             if (msg.channel == 0 && msg.type == LONG_PRESS) {
                 // RF1 long press - restart entire game (back to preparation)
-                Serial.println("RF1 long press detected - Restarting preparation phase...");
-                currentGameState = STATE_PREPARATION;
+                laneLog(lane, "RF1 long press detected - Restarting preparation phase...");
+                lane->state = STATE_PREPARATION;
                 break;
             }
         }
         /*
         // Check if 20 seconds have passed since last audio play
         if ((millis() - lastAudioTime) >= AUDIO_REPEAT_INTERVAL) {
-            Serial.println("Replaying ending audio (track 09)...");
-            playAudioInterrupt(9); // Audio 09 - goodbye (confirmed working)
+            laneLog(lane, "Replaying ending audio (track 09)...");
+            playAudioInterrupt(lane, 9); // Audio 09 - goodbye (confirmed working)
             lastAudioTime = millis();
         }
         */
         // Small delay to prevent busy waiting
+        laneRestartPoint(lane);
         vTaskDelay(50 / portTICK_PERIOD_MS);
     }
-    
-    Serial.println("Consequence phase completed - Restarting game");
-    
+
+    laneLog(lane, "Consequence phase completed - Restarting game");
+    heapReport("session end");
+
     // Task completes here - consequence is done
-    vTaskDelete(NULL);
-}
\ No newline at end of file
+    finishPhaseTask();
+}
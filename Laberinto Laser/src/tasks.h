@@ -1,7 +1,32 @@
 #pragma once
+#include "globals.h"
+
+void emergencyRestartLane(GameLane *lane);
 void rfControllerTask(void *pvParameters);
 void mainTask(void *pvParameters);
 
 void preparationTask(void *pvParameters);
 void questTask(void *pvParameters);
+uint8_t questDetect(GameLane *lane, uint8_t workingMask, uint8_t *pcfState);
+
+// Operator input collected during a turn and its changeover.
+struct Changeover {
+    bool nextQueued;     // RF1 short press: start the next player without waiting
+    bool endRequested;   // RF3 long press: end the session
+};
+
+enum QuestEvent { QUEST_CONTINUE, QUEST_HIT, QUEST_WON, QUEST_END, QUEST_TIMEOUT };
+
+// One questStep() call: the turn it belongs to and what it saw.
+struct QuestStep {
+    int playerNumber;
+    int lives;
+    uint32_t limitMs;
+    uint8_t workingMask;
+    Changeover *co;                  // RF1 short queues the next player here
+    unsigned long lastCheckpointMs;  // updated by the per-second checkpoint
+    uint8_t pcfState;                // last sample
+    uint8_t hitMask;                 // working beams broken, with QUEST_HIT
+};
+QuestEvent questStep(GameLane *lane, QuestStep *step);
 void consequenceTask(void *pvParameters);
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Compares two runs of the benchmark firmware (env esp32doit-devkit-v1-bench).
+
+Each run is the saved serial monitor output; non-JSON lines are ignored.
+A benchmark regresses when its median or p99 grows by more than the
+threshold (relative) and by more than the noise floor (absolute).
+
+Usage:
+  pio run -e esp32doit-devkit-v1-bench -t upload
+  pio device monitor -e esp32doit-devkit-v1-bench | tee after.txt
+  python3 tools/bench_compare.py before.txt after.txt [--threshold 10] [--floor 2]
+
+Exit status is 1 when any benchmark regressed or disappeared.
+"""
+import argparse
+import json
+import sys
+
+METRICS = ("median_us", "p99_us")
+
+
+def load(path):
+    results, header = {}, None
+    with open(path, errors="replace") as f:
+        for line in f:
+            start = line.find("{")
+            if start < 0:
+                continue
+            try:
+                rec = json.loads(line[start:])
+            except ValueError:
+                continue
+            if "bench" in rec:
+                results[rec["bench"]] = rec
+            elif "suite" in rec:
+                header = rec
+    if not results:
+        sys.exit(f"{path}: no benchmark results found")
+    return header, results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("baseline")
+    ap.add_argument("candidate")
+    ap.add_argument("--threshold", type=float, default=10.0,
+                    help="allowed growth in percent (default 10)")
+    ap.add_argument("--floor", type=float, default=2.0,
+                    help="ignore changes smaller than this many us (default 2)")
+    args = ap.parse_args()
+
+    base_hdr, base = load(args.baseline)
+    cand_hdr, cand = load(args.candidate)
+    if base_hdr and cand_hdr and base_hdr.get("cpu_mhz") != cand_hdr.get("cpu_mhz"):
+        print(f"warning: CPU clock differs ({base_hdr.get('cpu_mhz')} vs "
+              f"{cand_hdr.get('cpu_mhz')} MHz)")
+
+    regressed = False
+    print(f"{'benchmark':<22}{'metric':<11}{'baseline':>11}{'candidate':>11}{'change':>9}")
+    for name in sorted(set(base) | set(cand)):
+        if name not in cand:
+            print(f"{name:<22}missing from candidate")
+            regressed = True
+            continue
+        if name not in base:
+            print(f"{name:<22}new")
+            continue
+        for metric in METRICS:
+            old, new = base[name][metric], cand[name][metric]
+            pct = (new - old) * 100.0 / old if old else 0.0
+            flag = ""
+            if new - old > args.floor and pct > args.threshold:
+                flag = "  REGRESSED"
+                regressed = True
+            elif old - new > args.floor and -pct > args.threshold:
+                flag = "  improved"
+            print(f"{name:<22}{metric:<11}{old:>11.2f}{new:>11.2f}{pct:>+8.1f}%{flag}")
+        if cand[name].get("errors", 0) > base[name].get("errors", 0):
+            print(f"{name:<22}errors     {base[name].get('errors', 0):>11}"
+                  f"{cand[name]['errors']:>11}  REGRESSED")
+            regressed = True
+
+    sys.exit(1 if regressed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Generates src/sfx_samples.h: the short PCM effects played by the I2S mixer.
+
+The effects are synthesized so the firmware needs no audio assets:
+  hit      - falling square-ish sweep, played when a beam breaks
+  tick     - short click, played every second of the countdown
+  warning  - two beeps, played at the remaining-time milestones
+
+Usage: python3 tools/gen_sfx.py   (from the project directory)
+"""
+import math
+import os
+
+RATE = 16000
+OUT = os.path.join(os.path.dirname(__file__), "..", "src", "sfx_samples.h")
+
+
+def sweep(ms, f0, f1, amp):
+    n = RATE * ms // 1000
+    out, phase = [], 0.0
+    for i in range(n):
+        t = i / n
+        phase += 2 * math.pi * (f0 + (f1 - f0) * t) / RATE
+        s = math.sin(phase)
+        s = max(-1.0, min(1.0, 2.5 * s))   # soft-clipped, brighter than a sine
+        out.append(amp * s * (1.0 - t) ** 0.5)
+    return out
+
+
+def click(ms, freq, amp):
+    n = RATE * ms // 1000
+    return [amp * math.sin(2 * math.pi * freq * i / RATE) * math.exp(-i / (n / 5)) for i in range(n)]
+
+
+def beep(ms, freq, amp):
+    n = RATE * ms // 1000
+    ramp = RATE * 3 // 1000  # 3 ms fade in/out, no clicks
+    out = []
+    for i in range(n):
+        env = min(1.0, i / ramp, (n - 1 - i) / ramp)
+        out.append(amp * env * math.sin(2 * math.pi * freq * i / RATE))
+    return out
+
+
+def silence(ms):
+    return [0.0] * (RATE * ms // 1000)
+
+
+EFFECTS = [
+    ("hit", sweep(140, 1400, 250, 0.8)),
+    ("tick", click(25, 1800, 0.6)),
+    ("warning", beep(110, 880, 0.7) + silence(60) + beep(110, 880, 0.7)),
+]
+
+
+def main():
+    lines = [
+        "#pragma once",
+        "// Generated by tools/gen_sfx.py - do not edit.",
+        "#include <stdint.h>",
+        "",
+        "#define SFX_SAMPLE_RATE %d" % RATE,
+        "",
+    ]
+    for name, samples in EFFECTS:
+        pcm = [max(-32768, min(32767, int(round(s * 32767)))) for s in samples]
+        lines.append("static const int16_t sfx_%s[%d] = {" % (name, len(pcm)))
+        for i in range(0, len(pcm), 12):
+            lines.append("    " + ", ".join(str(v) for v in pcm[i:i + 12]) + ",")
+        lines.append("};")
+        lines.append("")
+    with open(OUT, "w") as f:
+        f.write("\n".join(lines))
+    print("wrote %s" % os.path.normpath(OUT))
+
+
+if __name__ == "__main__":
+    main()
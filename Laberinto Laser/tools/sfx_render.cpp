@@ -0,0 +1,81 @@
+// Renders a scripted sequence of the I2S sound effects through the firmware
+// mixer into a WAV file, to listen to the mix and check clipping without
+// hardware.
+//
+// Build and run from the project directory:
+//   g++ -O2 -Isrc tools/sfx_render.cpp src/mixer.cpp -o sfx_render
+//   ./sfx_render sfx_preview.wav
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "mixer.h"
+#include "sfx_samples.h"
+
+#define BLOCK_FRAMES 32   // same block size as sfxTask
+
+struct Cue {
+  uint32_t atMs;
+  const int16_t *data;
+  uint32_t length;
+  uint16_t gain;
+};
+
+#define CUE(ms, s, g) {ms, s, sizeof(s) / sizeof(s[0]), g}
+
+// Countdown ticks, a warning, then two hits close enough to overlap.
+static const Cue script[] = {
+  CUE(0, sfx_tick, MIXER_UNITY_GAIN * 3 / 4),
+  CUE(1000, sfx_tick, MIXER_UNITY_GAIN * 3 / 4),
+  CUE(2000, sfx_tick, MIXER_UNITY_GAIN * 3 / 4),
+  CUE(2500, sfx_warning, MIXER_UNITY_GAIN),
+  CUE(3500, sfx_hit, MIXER_UNITY_GAIN),
+  CUE(3560, sfx_hit, MIXER_UNITY_GAIN),
+  CUE(3600, sfx_tick, MIXER_UNITY_GAIN * 3 / 4),
+};
+#define SCRIPT_LEN (sizeof(script) / sizeof(script[0]))
+
+static void put16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put32(FILE *f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "sfx_preview.wav";
+  Mixer m;
+  mixerInit(&m);
+
+  std::vector<int16_t> pcm;
+  int16_t block[BLOCK_FRAMES];
+  size_t next = 0;
+  uint32_t clipped = 0;
+  // Cues start on block boundaries, as they do on target
+  while (next < SCRIPT_LEN || !mixerIdle(&m)) {
+    uint32_t nowMs = (uint32_t)(pcm.size() * 1000 / SFX_SAMPLE_RATE);
+    while (next < SCRIPT_LEN && script[next].atMs <= nowMs) {
+      mixerPlay(&m, script[next].data, script[next].length, script[next].gain);
+      next++;
+    }
+    mixerRender(&m, block, BLOCK_FRAMES);
+    for (int i = 0; i < BLOCK_FRAMES; i++) {
+      if (block[i] == 32767 || block[i] == -32768) clipped++;
+      pcm.push_back(block[i]);
+    }
+  }
+
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  uint32_t bytes = (uint32_t)(pcm.size() * 2);
+  fwrite("RIFF", 1, 4, f); put32(f, 36 + bytes);
+  fwrite("WAVEfmt ", 1, 8, f); put32(f, 16);
+  put16(f, 1); put16(f, 1);                        // PCM, mono
+  put32(f, SFX_SAMPLE_RATE); put32(f, SFX_SAMPLE_RATE * 2);
+  put16(f, 2); put16(f, 16);
+  fwrite("data", 1, 4, f); put32(f, bytes);
+  fwrite(pcm.data(), 2, pcm.size(), f);           // host is little-endian
+  fclose(f);
+
+  printf("%s: %.2f s, %u clipped samples\n", path,
+         (double)pcm.size() / SFX_SAMPLE_RATE, clipped);
+  return 0;
+}